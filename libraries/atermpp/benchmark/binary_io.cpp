@@ -0,0 +1,64 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "benchmark_shared.h"
+
+#include "mcrl2/atermpp/aterm_int.h"
+#include "mcrl2/atermpp/aterm_io_binary.h"
+#include "mcrl2/utilities/stopwatch.h"
+
+#include <sstream>
+
+using namespace atermpp;
+
+int main(int, char*[])
+{
+  std::size_t number_of_terms = 1000000;
+  std::size_t iterations = 10;
+
+  // Create a large number of distinct terms f(i, g(i)), which resembles the states in a state space.
+  function_symbol f("f", 2);
+  function_symbol g("g", 1);
+
+  std::vector<aterm_appl> terms;
+  terms.reserve(number_of_terms);
+  for (std::size_t i = 0; i < number_of_terms; ++i)
+  {
+    aterm_int value(i);
+    terms.emplace_back(f, value, aterm_appl(g, value));
+  }
+
+  for (std::size_t i = 0; i < iterations; ++i)
+  {
+    std::stringstream stream;
+
+    stopwatch write_watch;
+    {
+      binary_aterm_ostream output(stream);
+      for (const aterm_appl& term : terms)
+      {
+        output << term;
+      }
+    }
+    std::cerr << "Writing " << number_of_terms << " terms (" << stream.str().size() << " bytes) took " << write_watch.time() << " milliseconds.\n";
+
+    stopwatch read_watch;
+    {
+      binary_aterm_istream input(stream);
+      aterm term;
+      for (std::size_t j = 0; j < number_of_terms; ++j)
+      {
+        input >> term;
+      }
+    }
+    std::cerr << "Reading " << number_of_terms << " terms took " << read_watch.time() << " milliseconds.\n";
+  }
+
+  return 0;
+}
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "aterm_pool.h"
+#include "mcrl2/utilities/metrics.h"
 
 #include <chrono>
 
@@ -38,6 +39,10 @@ aterm_pool::aterm_pool() :
   
   // Initialize the empty list.
   m_empty_list = create_appl(m_function_symbol_pool.as_empty_list());
+
+  // The probes are only evaluated when the metrics are written.
+  mcrl2::utilities::metrics().add_probe("term_pool.size", [this]() { return size(); });
+  mcrl2::utilities::metrics().add_probe("term_pool.capacity", [this]() { return capacity(); });
 }
 
 aterm_pool::~aterm_pool()
@@ -180,6 +185,7 @@ void aterm_pool::collect()
     return;
   }
 
+  mcrl2::utilities::metrics_phase phase("term_pool.garbage_collection");
   auto timestamp = std::chrono::system_clock::now();
 
   m_deferred_garbage_collection = false;
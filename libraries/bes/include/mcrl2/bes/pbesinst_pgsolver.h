@@ -0,0 +1,236 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/bes/pbesinst_pgsolver.h
+/// \brief Instantiation of a PBES that writes the result directly in PGSolver format.
+
+#ifndef MCRL2_BES_PBESINST_PGSOLVER_H
+#define MCRL2_BES_PBESINST_PGSOLVER_H
+
+#include "mcrl2/pbes/pbesinst_algorithm.h"
+#include <limits>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace mcrl2
+{
+
+namespace bes
+{
+
+/// \brief Variant of the pbesinst algorithm that writes the instantiated equations to a stream in
+/// PGSolver format while they are generated, instead of storing them in a BES.
+/// \details The instantiations are numbered 0, 1, ... in the order in which they are found, so the
+/// initial instantiation is vertex 0. Right hand sides that are not a plain conjunction or disjunction
+/// of instantiations get an auxiliary vertex for each nested subformula, like in the standard form of
+/// a BES. The priority of a vertex is determined by the block of its PBES equation, and the constants
+/// true and false are represented by vertices with a self loop.
+class pbesinst_pgsolver_algorithm: public pbes_system::pbesinst_algorithm
+{
+  protected:
+    typedef pbes_system::pbesinst_algorithm super;
+
+    /// \brief The stream to which the parity game is written.
+    std::ostream& m_out;
+
+    /// \brief If true a max-parity game is written, otherwise a min-parity game.
+    bool m_maxpg;
+
+    /// \brief The priority of the vertices of the i-th PBES equation.
+    std::vector<std::size_t> m_priorities;
+
+    /// \brief The vertices of the instantiations that have been found.
+    std::unordered_map<pbes_system::propositional_variable_instantiation, std::size_t> m_vertices;
+
+    /// \brief The number of vertices that have been assigned.
+    std::size_t m_vertex_count = 0;
+
+    /// \brief The vertex of the constant true, or npos() if it is not yet used.
+    std::size_t m_true_vertex = npos();
+
+    /// \brief The vertex of the constant false, or npos() if it is not yet used.
+    std::size_t m_false_vertex = npos();
+
+    static constexpr std::size_t npos()
+    {
+      return std::numeric_limits<std::size_t>::max();
+    }
+
+    void write_vertex(std::size_t v, std::size_t priority, int owner, const std::vector<std::size_t>& successors)
+    {
+      m_out << v << " " << priority << " " << owner << " ";
+      for (auto i = successors.begin(); i != successors.end(); ++i)
+      {
+        m_out << (i == successors.begin() ? "" : ",") << *i;
+      }
+      m_out << ";\n";
+    }
+
+    std::size_t vertex(const pbes_system::propositional_variable_instantiation& X_e)
+    {
+      auto i = m_vertices.find(X_e);
+      if (i == m_vertices.end())
+      {
+        i = m_vertices.emplace(X_e, m_vertex_count++).first;
+      }
+      return i->second;
+    }
+
+    /// \brief Adds the operands of nested applications of the same operator as x to the result, from left to right.
+    void collect_operands(const pbes_system::pbes_expression& x, bool is_conjunction, std::vector<pbes_system::pbes_expression>& result) const
+    {
+      if (is_conjunction && pbes_system::is_and(x))
+      {
+        const auto& x_ = atermpp::down_cast<pbes_system::and_>(x);
+        collect_operands(x_.left(), is_conjunction, result);
+        collect_operands(x_.right(), is_conjunction, result);
+      }
+      else if (!is_conjunction && pbes_system::is_or(x))
+      {
+        const auto& x_ = atermpp::down_cast<pbes_system::or_>(x);
+        collect_operands(x_.left(), is_conjunction, result);
+        collect_operands(x_.right(), is_conjunction, result);
+      }
+      else
+      {
+        result.push_back(x);
+      }
+    }
+
+    /// \brief Writes the vertex v with right hand side x, followed by the vertices that are created for
+    /// subformulas of x. A reader that takes the first vertex as the initial one thus finds vertex 0.
+    void write_formula(std::size_t v, const pbes_system::pbes_expression& x, std::size_t priority)
+    {
+      std::vector<pbes_system::pbes_expression> operands;
+      int owner = 0;
+      if (pbes_system::is_and(x))
+      {
+        owner = 1;
+        collect_operands(x, true, operands);
+      }
+      else if (pbes_system::is_or(x))
+      {
+        collect_operands(x, false, operands);
+      }
+      else if (pbes_system::is_propositional_variable_instantiation(x) || pbes_system::is_true(x) || pbes_system::is_false(x))
+      {
+        operands.push_back(x);
+      }
+      else
+      {
+        throw mcrl2::runtime_error("Unsupported expression encountered while saving in PGSolver format: " + pbes_system::pp(x));
+      }
+
+      std::vector<std::size_t> successors;
+      std::vector<std::pair<std::size_t, pbes_system::pbes_expression>> new_vertices;
+      for (const pbes_system::pbes_expression& y: operands)
+      {
+        if (pbes_system::is_propositional_variable_instantiation(y))
+        {
+          successors.push_back(vertex(atermpp::down_cast<pbes_system::propositional_variable_instantiation>(y)));
+          continue;
+        }
+        std::size_t w = m_vertex_count;
+        if (pbes_system::is_true(y) || pbes_system::is_false(y))
+        {
+          std::size_t& constant = pbes_system::is_true(y) ? m_true_vertex : m_false_vertex;
+          if (constant != npos())
+          {
+            successors.push_back(constant);
+            continue;
+          }
+          constant = w;
+        }
+        m_vertex_count++;
+        successors.push_back(w);
+        new_vertices.emplace_back(w, y);
+      }
+      write_vertex(v, priority, owner, successors);
+
+      for (const auto& [w, y]: new_vertices)
+      {
+        if (pbes_system::is_true(y) || pbes_system::is_false(y))
+        {
+          // Player even wins in a vertex with an even priority and a self loop.
+          write_vertex(w, pbes_system::is_true(y) ? 0 : 1, 0, { w });
+        }
+        else
+        {
+          write_formula(w, y, priority);
+        }
+      }
+    }
+
+    void on_report_equation(const pbes_system::propositional_variable_instantiation& X_e,
+                            const pbes_system::pbes_expression& psi_e,
+                            const pbes_system::fixpoint_symbol& /* symbol */,
+                            std::size_t index
+                           ) override
+    {
+      write_formula(vertex(X_e), psi_e, m_priorities[index]);
+    }
+
+  public:
+    /// \brief Constructor.
+    /// \param data_spec A data specification.
+    /// \param rewrite_strategy A strategy for the data rewriter.
+    /// \param out The stream to which the parity game is written.
+    /// \param maxpg If true a max-parity game is written, otherwise a min-parity game.
+    pbesinst_pgsolver_algorithm(const data::data_specification& data_spec,
+                                data::rewriter::strategy rewrite_strategy,
+                                std::ostream& out,
+                                bool maxpg = true
+                               )
+      : super(data_spec, rewrite_strategy),
+        m_out(out),
+        m_maxpg(maxpg)
+    {}
+
+    /// \brief Runs the algorithm, and writes the parity game to the stream.
+    /// \param p A PBES.
+    void run(pbes_system::pbes& p)
+    {
+      // The priorities are numbered as in save_bes_pgsolver: the blocks get priorities 0, 1, ...,
+      // where a first block with fixpoint symbol mu gets priority 1.
+      std::size_t priority = 0;
+      pbes_system::fixpoint_symbol sigma = pbes_system::fixpoint_symbol::nu();
+      for (const pbes_system::pbes_equation& eqn: p.equations())
+      {
+        if (eqn.symbol() != sigma)
+        {
+          ++priority;
+          sigma = eqn.symbol();
+        }
+        m_priorities.push_back(priority);
+      }
+      if (m_maxpg)
+      {
+        // Reverse the order of the priorities, while keeping their parity.
+        std::size_t max_priority = priority + priority % 2;
+        for (std::size_t& i: m_priorities)
+        {
+          i = max_priority - i;
+        }
+      }
+      super::run(p);
+      m_out.flush();
+    }
+
+    /// \brief Returns the number of vertices that have been written.
+    std::size_t vertex_count() const
+    {
+      return m_vertex_count;
+    }
+};
+
+} // namespace bes
+
+} // namespace mcrl2
+
+#endif // MCRL2_BES_PBESINST_PGSOLVER_H
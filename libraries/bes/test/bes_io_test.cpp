@@ -12,10 +12,14 @@
 #define BOOST_TEST_MODULE bes_io_test
 #include <boost/test/included/unit_test_framework.hpp>
 
+#include "mcrl2/bes/gauss_elimination.h"
 #include "mcrl2/bes/io.h"
 #include "mcrl2/bes/parse.h"
-#include "mcrl2/bes/print.h"
 #include "mcrl2/bes/pbesinst_conversion.h"
+#include "mcrl2/bes/pbesinst_pgsolver.h"
+#include "mcrl2/bes/pg_parse.h"
+#include "mcrl2/bes/print.h"
+#include "mcrl2/pbes/txt2pbes.h"
 
 using namespace mcrl2;
 using namespace mcrl2::bes;
@@ -75,6 +79,53 @@ void test_pgsolver()
   std::clog << out.str() << std::endl;
 }
 
+// Checks that the parity game that is written during instantiation has the same solution
+// as the BES that is computed by pbesinst.
+void test_pbesinst_pgsolver(const std::string& text)
+{
+  pbes_system::pbes p = pbes_system::txt2pbes(text);
+  pbes_system::pbesinst_algorithm algorithm(p.data());
+  algorithm.run(p);
+  boolean_equation_system b = pbesinst_conversion(algorithm.get_result());
+  bool expected_result = gauss_elimination(b);
+
+  for (bool maxpg: { true, false })
+  {
+    pbes_system::pbes q = pbes_system::txt2pbes(text);
+    std::stringstream out;
+    pbesinst_pgsolver_algorithm pgsolver_algorithm(q.data(), data::jitty, out, maxpg);
+    pgsolver_algorithm.run(q);
+    std::clog << out.str() << std::endl;
+
+    boolean_equation_system game;
+    parse_pgsolver(out, game, maxpg);
+    BOOST_CHECK_EQUAL(game.equations().size(), pgsolver_algorithm.vertex_count());
+    BOOST_CHECK_EQUAL(gauss_elimination(game), expected_result);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_pbesinst_pgsolver_output)
+{
+  test_pbesinst_pgsolver(
+    "pbes nu X(n: Nat) = val(n < 3) => (X(n + 2) && X(n + 1)); \n"
+    "init X(0);                                                \n"
+  );
+  test_pbesinst_pgsolver(
+    "pbes mu X(n: Nat) = val(n == 4) || X((n + 1) mod 6);      \n"
+    "init X(0);                                                \n"
+  );
+  test_pbesinst_pgsolver(
+    "pbes nu X(b: Bool) = Y(b) && (Y(!b) || X(!b));            \n"
+    "     mu Y(b: Bool) = val(b) || X(true);                   \n"
+    "init X(false);                                            \n"
+  );
+  test_pbesinst_pgsolver(
+    "pbes mu X(n: Nat) = val(n < 2) && (X(n + 1) || Y(n));     \n"
+    "     nu Y(n: Nat) = val(n > 0) && Y(n) || X(n + 5);       \n"
+    "init X(0);                                                \n"
+  );
+}
+
 BOOST_AUTO_TEST_CASE(test_main)
 {
   test_parse_bes();
@@ -7,8 +7,8 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 //
 /// \file mcrl2/data/detail/enumerator_iteration_limit.h
-/// \brief Stores a static variable that indicates the number of iterations
-/// allowed during enumeration
+/// \brief Stores static variables that indicate the number of iterations
+/// allowed during enumeration, and the size of the enumerator queue
 
 #ifndef MCRL2_DATA_DETAIL_ENUMERATOR_ITERATION_LIMIT_H
 #define MCRL2_DATA_DETAIL_ENUMERATOR_ITERATION_LIMIT_H
@@ -44,6 +44,29 @@ std::size_t get_enumerator_iteration_limit()
   return enumerator_iteration_limit<std::size_t>::max_enumerator_iterations;
 }
 
+// Stores the size of the enumerator queue above which the enumeration proceeds depth first.
+template <class T> // note, T is only a dummy
+struct enumerator_queue_limit
+{
+  static std::size_t max_enumerator_queue_size;
+};
+
+// Initialization
+template <class T>
+std::size_t enumerator_queue_limit<T>::max_enumerator_queue_size = 1000000;
+
+inline
+void set_enumerator_queue_limit(std::size_t size)
+{
+  enumerator_queue_limit<std::size_t>::max_enumerator_queue_size = size;
+}
+
+inline
+std::size_t get_enumerator_queue_limit()
+{
+  return enumerator_queue_limit<std::size_t>::max_enumerator_queue_size;
+}
+
 } // namespace detail
 
 } // namespace data
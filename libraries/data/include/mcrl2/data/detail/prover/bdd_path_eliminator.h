@@ -18,6 +18,9 @@
 #include "mcrl2/data/detail/prover/smt_lib_solver.h"
 #include "mcrl2/data/detail/prover/solver_type.h"
 
+#include <memory>
+#include <unordered_map>
+
 namespace mcrl2
 {
 namespace data
@@ -46,6 +49,11 @@ namespace detail
  * The method BDD_Path_Eliminator::simplify receives a BDD as
  * parameter a_bdd and returns the equivalent BDD from which all
  * inconsistent paths have been removed.
+ *
+ * Every query starts a new process of the SMT solver. As the sets of
+ * guards that are checked are kept minimal, the same set is typically
+ * checked for many paths of a BDD, and for many BDDs. Therefore the
+ * answers of the SMT solver are cached.
 */
 class BDD_Path_Eliminator: public BDD_Simplifier
 {
@@ -53,7 +61,32 @@ class BDD_Path_Eliminator: public BDD_Simplifier
   private:
 
     /// \brief Pointer to an SMT solver used to determine whether or not a path is inconsistent.
-    SMT_Solver* f_smt_solver;
+    std::unique_ptr<SMT_Solver> f_smt_solver;
+
+    /// \brief The answers of the SMT solver, indexed by the sorted conditions.
+    std::unordered_map<data_expression_list, bool> f_satisfiability_cache;
+
+    /// \brief Returns true if the conjunction of the guards in a_condition is satisfiable, using the
+    /// \brief answers of earlier queries when possible.
+    /// \param a_condition A list of guards and negated guards.
+    bool is_satisfiable(const data_expression_list& a_condition)
+    {
+      // The order and multiplicity of the guards in a conjunction is irrelevant.
+      std::vector<data_expression> v_guards(a_condition.begin(), a_condition.end());
+      std::sort(v_guards.begin(), v_guards.end());
+      v_guards.erase(std::unique(v_guards.begin(), v_guards.end()), v_guards.end());
+      const data_expression_list v_key(v_guards.begin(), v_guards.end());
+
+      auto i = f_satisfiability_cache.find(v_key);
+      if (i != f_satisfiability_cache.end())
+      {
+        return i->second;
+      }
+
+      const bool v_satisfiable = f_smt_solver->is_satisfiable(v_key);
+      f_satisfiability_cache.emplace(v_key, v_satisfiable);
+      return v_satisfiable;
+    }
 
     /// \brief Class that provides information about the structure of BDDs.
     BDD_Info f_bdd_info;
@@ -128,7 +161,7 @@ class BDD_Path_Eliminator: public BDD_Simplifier
       const data_expression v_guard = f_bdd_info.get_guard(a_bdd);
       const data_expression v_negated_guard = sort_bool::not_(v_guard);
       const data_expression_list v_true_condition = create_condition(a_path, v_guard, true);
-      bool v_true_branch_enabled = f_smt_solver->is_satisfiable(v_true_condition);
+      bool v_true_branch_enabled = is_satisfiable(v_true_condition);
       if (!v_true_branch_enabled)
       {
         data_expression_list v_false_path=a_path;
@@ -138,7 +171,7 @@ class BDD_Path_Eliminator: public BDD_Simplifier
       else
       {
         data_expression_list v_false_condition = create_condition(a_path, v_negated_guard, true);
-        bool v_false_branch_enabled = f_smt_solver->is_satisfiable(v_false_condition);
+        bool v_false_branch_enabled = is_satisfiable(v_false_condition);
         if (!v_false_branch_enabled)
         {
           data_expression_list v_true_path = a_path;
@@ -187,7 +220,7 @@ class BDD_Path_Eliminator: public BDD_Simplifier
       {
         if (mcrl2::data::detail::prover::cvc_smt_solver::usable())
         {
-          f_smt_solver = new mcrl2::data::detail::prover::cvc_smt_solver();
+          f_smt_solver.reset(new mcrl2::data::detail::prover::cvc_smt_solver());
 
           return;
         }
@@ -196,7 +229,7 @@ class BDD_Path_Eliminator: public BDD_Simplifier
       {
         if (mcrl2::data::detail::prover::z3_smt_solver::usable())
         {
-          f_smt_solver = new mcrl2::data::detail::prover::z3_smt_solver();
+          f_smt_solver.reset(new mcrl2::data::detail::prover::z3_smt_solver());
 
           return;
         }
@@ -210,6 +243,14 @@ class BDD_Path_Eliminator: public BDD_Simplifier
 #endif // _MSC_VER
     }
 
+    /// \brief Constructor that uses the given SMT solver, for instance one that is implemented in-process.
+    /// \param a_smt_solver An SMT solver.
+    explicit BDD_Path_Eliminator(std::unique_ptr<SMT_Solver> a_smt_solver)
+      : f_smt_solver(std::move(a_smt_solver))
+    {
+      assert(f_smt_solver != nullptr);
+    }
+
     /// \brief Returns a BDD without inconsistent paths, equivalent to a_bdd.
     /// precondition: The argument passed as parameter a_bdd is a data expression in internal mCRL2 format with the
     /// following restrictions: It either represents the constant true or the constant false, or it is an if-then-else
@@ -15,6 +15,10 @@
 #include "mcrl2/data/rewrite_strategy.h"
 #include "mcrl2/data/selection.h"
 #include "mcrl2/data/substitutions/mutable_indexed_substitution.h"
+#include "mcrl2/utilities/fixed_size_cache.h"
+#include "mcrl2/utilities/metrics.h"
+
+#include <algorithm>
 
 namespace mcrl2
 {
@@ -23,6 +27,15 @@ namespace data
 namespace detail
 {
 
+/// \brief Returns the maximal number of terms of which a rewriter caches the normal form, where 0 disables the cache.
+/// \details It is set by the option --normal-form-cache of tools that use a rewriter.
+inline
+std::size_t& normal_form_cache_size()
+{
+  static std::size_t size = 0;
+  return size;
+}
+
 /**
  * \brief Rewriter interface class.
  *
@@ -54,8 +67,18 @@ class Rewriter
      **/
     Rewriter(const data_specification& data_spec, const used_data_equation_selector& eq_selector):
           data_equation_selector(eq_selector),
-          m_data_specification_for_enumeration(data_spec)
+          m_data_specification_for_enumeration(data_spec),
+          m_rewrite_calls_metric(utilities::metrics().enabled() ? &utilities::metrics().counter("rewriter.rewrite_calls") : nullptr)
     {
+      if (normal_form_cache_size() > 0)
+      {
+        m_normal_form_cache.reset(new normal_form_cache_type(normal_form_cache_size()));
+        if (utilities::metrics().enabled())
+        {
+          m_normal_form_cache_hits_metric = &utilities::metrics().counter("rewriter.normal_form_cache_hits");
+          m_normal_form_cache_misses_metric = &utilities::metrics().counter("rewriter.normal_form_cache_misses");
+        }
+      }
     }
 
     /** \brief The copy assignment operator is deleted. Copying is not allowed.
@@ -106,6 +129,18 @@ class Rewriter
       return rewrite(term,sigma);
     }
 
+    /// \brief Returns the number of rewritten terms whose normal form was found in the normal form cache.
+    std::size_t normal_form_cache_hits() const
+    {
+      return m_normal_form_cache_hits;
+    }
+
+    /// \brief Returns the number of rewritten closed terms whose normal form was not found in the normal form cache.
+    std::size_t normal_form_cache_misses() const
+    {
+      return m_normal_form_cache_misses;
+    }
+
   public:
   /* The functions below are public, because they are used in the compiling jitty rewriter */
     data_expression existential_quantifier_enumeration(
@@ -157,6 +192,123 @@ class Rewriter
 
     const mcrl2::data::data_specification m_data_specification_for_enumeration;
 
+    /// \brief The counter of calls of rewrite, or nullptr if no metrics are collected.
+    utilities::metric_counter* m_rewrite_calls_metric;
+
+    /// \brief Maps closed terms to their normal forms.
+    typedef utilities::fifo_cache<data_expression, data_expression> normal_form_cache_type;
+
+    /// \brief The normal forms of recently rewritten closed terms, or nullptr if the cache is disabled.
+    /// \details As the cache belongs to a rewriter it is never used for another data specification.
+    std::unique_ptr<normal_form_cache_type> m_normal_form_cache;
+
+    /// \brief The number of lookups in the normal form cache that found the normal form.
+    std::size_t m_normal_form_cache_hits = 0;
+
+    /// \brief The number of lookups in the normal form cache that did not find the normal form.
+    std::size_t m_normal_form_cache_misses = 0;
+
+    /// \brief The counters of the hits and misses in the metrics registry, or nullptr if no metrics are collected.
+    utilities::metric_counter* m_normal_form_cache_hits_metric = nullptr;
+    utilities::metric_counter* m_normal_form_cache_misses_metric = nullptr;
+
+    /// \brief Returns true if t contains neither variables nor binders.
+    static bool is_closed(const data_expression& t)
+    {
+      if (is_function_symbol(t))
+      {
+        return true;
+      }
+      if (is_application(t))
+      {
+        const application& ta = atermpp::down_cast<application>(t);
+        return is_closed(ta.head()) && std::all_of(ta.begin(), ta.end(), [](const data_expression& x) { return is_closed(x); });
+      }
+      return false;
+    }
+
+    /// \brief Computes result = t[sigma] in a single traversal of t, if t contains no binders and
+    ///        every variable of t is mapped by sigma to a closed term.
+    /// \return True if result is a closed term, in which case it has the same normal form as t under sigma.
+    static bool closed_instance(const data_expression& t, substitution_type& sigma, data_expression& result)
+    {
+      if (is_function_symbol(t))
+      {
+        result = t;
+        return true;
+      }
+      if (is_variable(t))
+      {
+        result = sigma(atermpp::down_cast<variable>(t));
+        return result != t && is_closed(result);
+      }
+      if (is_application(t))
+      {
+        const application& ta = atermpp::down_cast<application>(t);
+        data_expression head;
+        if (!closed_instance(ta.head(), sigma, head))
+        {
+          return false;
+        }
+        std::vector<data_expression> arguments(ta.size());
+        for (std::size_t i = 0; i < ta.size(); ++i)
+        {
+          if (!closed_instance(ta[i], sigma, arguments[i]))
+          {
+            return false;
+          }
+        }
+        result = application(head, arguments.begin(), arguments.end());
+        return true;
+      }
+      return false;
+    }
+
+    /// \brief Returns rewrite(), which must compute the normal form of t under sigma, using the normal form
+    ///        cache if t[sigma] is closed. The values of sigma must be normal forms, as for rewrite.
+    /// \details Only the complete term is looked up, such that determining whether it is closed takes a
+    ///          single traversal. Terms that are not closed are not stored in the cache.
+    /// \pre m_normal_form_cache != nullptr
+    template <typename Rewrite>
+    data_expression rewrite_with_normal_form_cache(const data_expression& t, substitution_type& sigma, Rewrite rewrite)
+    {
+      data_expression key;
+      if (!closed_instance(t, sigma, key))
+      {
+        return rewrite();
+      }
+
+      auto i = m_normal_form_cache->find(key);
+      if (i != m_normal_form_cache->end())
+      {
+        m_normal_form_cache_hits++;
+        if (m_normal_form_cache_hits_metric != nullptr)
+        {
+          m_normal_form_cache_hits_metric->add();
+        }
+        return i->second;
+      }
+      m_normal_form_cache_misses++;
+      if (m_normal_form_cache_misses_metric != nullptr)
+      {
+        m_normal_form_cache_misses_metric->add();
+      }
+
+      // The iterator i is not used anymore, as rewriting can change the cache.
+      data_expression result = rewrite();
+      m_normal_form_cache->emplace(key, result);
+      return result;
+    }
+
+    /// \brief Counts a call of rewrite in the metrics registry, if it is enabled.
+    void count_rewrite_call()
+    {
+      if (m_rewrite_calls_metric != nullptr)
+      {
+        m_rewrite_calls_metric->add();
+      }
+    }
+
     data_expression quantifier_enumeration(
           const variable_list& vl,
           const data_expression& t1,
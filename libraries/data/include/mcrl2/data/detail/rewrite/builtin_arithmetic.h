@@ -0,0 +1,380 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/data/detail/rewrite/builtin_arithmetic.h
+/// \brief Evaluation of arithmetic on numerals of sort Pos, Nat and Int using machine integers.
+
+#ifndef MCRL2_DATA_DETAIL_REWRITE_BUILTIN_ARITHMETIC_H
+#define MCRL2_DATA_DETAIL_REWRITE_BUILTIN_ARITHMETIC_H
+
+#include "mcrl2/data/int.h"
+#include "mcrl2/data/standard.h"
+#include "mcrl2/data/standard_numbers_utility.h"
+#include "mcrl2/utilities/metrics.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace mcrl2
+{
+namespace data
+{
+namespace detail
+{
+
+/// \brief Evaluates applications of the standard arithmetic and comparison mappings on Pos, Nat and Int
+///        to numerals, such as 5 + 3 or x div 2 with x a numeral, using machine integers.
+/// \details The numerals keep their symbolic representation with @c1, @cDub, @c0, @cNat, @cInt and @cNeg.
+///          Instead of applying dozens of rewrite rules on binary digits, the arguments are converted to
+///          machine integers and the result is converted back. If an argument is not a numeral, or the result
+///          does not fit in a machine integer, or it does not fit the result sort, evaluation fails and the
+///          rewriter applies the rewrite rules instead.
+class builtin_arithmetic
+{
+  protected:
+    enum class operation : unsigned char
+    {
+      unknown, // The function symbol has not been classified yet.
+      none,
+      plus, minus, times, div, mod, exp, maximum, minimum, monus,
+      succ, pred, negate, abs, convert,
+      equal, not_equal, less, less_equal, greater, greater_equal
+    };
+
+    // The operations of function symbols, indexed by the index of the function symbol.
+    std::vector<operation> m_operations;
+
+    // The counter of evaluated applications, or nullptr if no metrics are collected.
+    utilities::metric_counter* m_evaluations_metric = utilities::metrics().enabled() ? &utilities::metrics().counter("rewriter.builtin_arithmetic_evaluations") : nullptr;
+
+    // Numerals with at most this number of bits are converted, such that sums and differences do not overflow.
+    static constexpr std::size_t max_bits = 62;
+
+    static bool is_number_sort(const sort_expression& s)
+    {
+      return s == sort_pos::pos() || s == sort_nat::nat() || s == sort_int::int_();
+    }
+
+    static bool is_unary(operation op)
+    {
+      return op == operation::succ || op == operation::pred || op == operation::negate ||
+             op == operation::abs || op == operation::convert;
+    }
+
+    /// \brief Returns the operation of f, where only the system defined function symbols on Pos, Nat and Int
+    ///        are classified. A user defined mapping with the same name, such as max: Pos # Pos -> Bool, is not.
+    static operation classify(const function_symbol& f)
+    {
+      if (!is_function_sort(f.sort()))
+      {
+        return operation::none;
+      }
+
+      // The comparisons are defined for every sort, so their domain is checked.
+      const function_sort& s = atermpp::down_cast<function_sort>(f.sort());
+      if (s.domain().size() == 2 && std::all_of(s.domain().begin(), s.domain().end(), is_number_sort))
+      {
+        if (equal_symbol::is_function_symbol(f)) { return operation::equal; }
+        if (not_equal_symbol::is_function_symbol(f)) { return operation::not_equal; }
+        if (less_symbol::is_function_symbol(f)) { return operation::less; }
+        if (less_equal_symbol::is_function_symbol(f)) { return operation::less_equal; }
+        if (greater_symbol::is_function_symbol(f)) { return operation::greater; }
+        if (greater_equal_symbol::is_function_symbol(f)) { return operation::greater_equal; }
+      }
+
+      // The recognisers of sort_int include the overloads on Pos and Nat.
+      if (sort_int::is_succ_function_symbol(f)) { return operation::succ; }
+      if (sort_int::is_pred_function_symbol(f) || sort_nat::is_pred_function_symbol(f)) { return operation::pred; }
+      if (sort_int::is_negate_function_symbol(f)) { return operation::negate; }
+      if (sort_int::is_abs_function_symbol(f)) { return operation::abs; }
+      if (sort_nat::is_pos2nat_function_symbol(f) || sort_nat::is_nat2pos_function_symbol(f) ||
+          sort_int::is_nat2int_function_symbol(f) || sort_int::is_int2nat_function_symbol(f) ||
+          sort_int::is_pos2int_function_symbol(f) || sort_int::is_int2pos_function_symbol(f))
+      {
+        return operation::convert;
+      }
+      if (sort_int::is_plus_function_symbol(f)) { return operation::plus; }
+      if (sort_int::is_minus_function_symbol(f)) { return operation::minus; }
+      if (sort_int::is_times_function_symbol(f)) { return operation::times; }
+      if (sort_int::is_div_function_symbol(f)) { return operation::div; }
+      if (sort_int::is_mod_function_symbol(f)) { return operation::mod; }
+      if (sort_int::is_exp_function_symbol(f)) { return operation::exp; }
+      if (sort_int::is_maximum_function_symbol(f)) { return operation::maximum; }
+      if (sort_int::is_minimum_function_symbol(f)) { return operation::minimum; }
+      if (sort_nat::is_monus_function_symbol(f)) { return operation::monus; }
+      return operation::none;
+    }
+
+    operation get_operation(const function_symbol& f)
+    {
+      const std::size_t index = core::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(f);
+      if (index >= m_operations.size())
+      {
+        m_operations.resize(index + 1, operation::unknown);
+      }
+      if (m_operations[index] == operation::unknown)
+      {
+        m_operations[index] = classify(f);
+      }
+      return m_operations[index];
+    }
+
+    /// \brief Converts a positive numeral with at most max_bits bits to a machine integer.
+    static bool positive_as_machine_number(const data_expression& t, std::int64_t& result)
+    {
+      std::int64_t value = 0;
+      std::size_t bit = 0;
+      const data_expression* p = &t;
+      while (sort_pos::is_cdub_application(*p))
+      {
+        const data_expression& b = sort_pos::left(*p);
+        if (sort_bool::is_true_function_symbol(b))
+        {
+          value |= std::int64_t(1) << bit;
+        }
+        else if (!sort_bool::is_false_function_symbol(b))
+        {
+          return false;
+        }
+        if (++bit == max_bits)
+        {
+          return false;
+        }
+        p = &sort_pos::right(*p);
+      }
+      if (!sort_pos::is_c1_function_symbol(*p))
+      {
+        return false;
+      }
+      result = value | (std::int64_t(1) << bit);
+      return true;
+    }
+
+    /// \brief Converts a numeral of sort Pos, Nat or Int to a machine integer.
+    static bool as_machine_number(const data_expression& t, std::int64_t& result)
+    {
+      if (sort_nat::is_c0_function_symbol(t))
+      {
+        result = 0;
+        return true;
+      }
+      if (sort_nat::is_cnat_application(t))
+      {
+        return positive_as_machine_number(sort_nat::arg(t), result);
+      }
+      if (sort_int::is_cint_application(t))
+      {
+        return as_machine_number(sort_int::arg(t), result);
+      }
+      if (sort_int::is_cneg_application(t))
+      {
+        if (positive_as_machine_number(sort_int::arg(t), result))
+        {
+          result = -result;
+          return true;
+        }
+        return false;
+      }
+      return positive_as_machine_number(t, result);
+    }
+
+    /// \brief Converts n to a numeral of sort s, if n is an element of s.
+    static bool from_machine_number(std::int64_t n, const sort_expression& s, data_expression& result)
+    {
+      if (s == sort_int::int_())
+      {
+        result = sort_int::int_(n);
+        return true;
+      }
+      if (n < 0 || (n == 0 && s == sort_pos::pos()))
+      {
+        return false;
+      }
+      result = (s == sort_nat::nat() ? sort_nat::nat(static_cast<std::uint64_t>(n)) : sort_pos::pos(static_cast<std::uint64_t>(n)));
+      return true;
+    }
+
+    /// \brief Computes x * y, unless this overflows.
+    static bool multiply(std::int64_t x, std::int64_t y, std::int64_t& result)
+    {
+      if (x != 0 && y != 0)
+      {
+        const std::uint64_t abs_x = static_cast<std::uint64_t>(x < 0 ? -x : x);
+        const std::uint64_t abs_y = static_cast<std::uint64_t>(y < 0 ? -y : y);
+        if (abs_x > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) / abs_y)
+        {
+          return false;
+        }
+      }
+      result = x * y;
+      return true;
+    }
+
+    /// \brief Computes x to the power y, unless this overflows.
+    static bool power(std::int64_t x, std::int64_t y, std::int64_t& result)
+    {
+      if (y < 0)
+      {
+        return false;
+      }
+      if (x == 0 || x == 1)
+      {
+        result = (y == 0 ? 1 : x);
+        return true;
+      }
+      if (x == -1)
+      {
+        result = (y % 2 == 0 ? 1 : -1);
+        return true;
+      }
+      // As |x| >= 2 the loop fails after at most 63 iterations.
+      result = 1;
+      for (std::int64_t i = 0; i < y; ++i)
+      {
+        if (!multiply(result, x, result))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    static bool evaluate_binary(operation op, std::int64_t x, std::int64_t y, std::int64_t& result)
+    {
+      switch (op)
+      {
+        case operation::plus: result = x + y; return true;
+        case operation::minus: result = x - y; return true;
+        case operation::times: return multiply(x, y, result);
+        case operation::exp: return power(x, y, result);
+        case operation::maximum: result = std::max(x, y); return true;
+        case operation::minimum: result = std::min(x, y); return true;
+        case operation::monus: result = (x > y ? x - y : 0); return true;
+        case operation::div:
+        case operation::mod:
+        {
+          // Division rounds towards minus infinity, such that the remainder is not negative.
+          if (y <= 0)
+          {
+            return false;
+          }
+          std::int64_t quotient = x / y;
+          std::int64_t remainder = x % y;
+          if (remainder < 0)
+          {
+            --quotient;
+            remainder += y;
+          }
+          result = (op == operation::div ? quotient : remainder);
+          return true;
+        }
+        default: return false;
+      }
+    }
+
+    static bool evaluate_unary(operation op, std::int64_t x, std::int64_t& result)
+    {
+      switch (op)
+      {
+        case operation::succ: result = x + 1; return true;
+        case operation::pred: result = x - 1; return true;
+        case operation::negate: result = -x; return true;
+        case operation::abs: result = (x < 0 ? -x : x); return true;
+        case operation::convert: result = x; return true;
+        default: return false;
+      }
+    }
+
+    static bool compare(operation op, std::int64_t x, std::int64_t y)
+    {
+      switch (op)
+      {
+        case operation::equal: return x == y;
+        case operation::not_equal: return x != y;
+        case operation::less: return x < y;
+        case operation::less_equal: return x <= y;
+        case operation::greater: return x > y;
+        default: assert(op == operation::greater_equal); return x >= y;
+      }
+    }
+
+    /// \brief Evaluates f(args[0], ..., args[arity-1]) if all arguments are numerals.
+    bool evaluate_numerals(const function_symbol& f, const data_expression* args, std::size_t arity, data_expression& result)
+    {
+      const operation op = get_operation(f);
+      assert(is_builtin(f, arity));
+      std::int64_t x;
+      if (!as_machine_number(args[0], x))
+      {
+        return false;
+      }
+
+      std::int64_t value;
+      if (arity == 1)
+      {
+        return evaluate_unary(op, x, value) &&
+               from_machine_number(value, atermpp::down_cast<function_sort>(f.sort()).codomain(), result);
+      }
+
+      std::int64_t y;
+      if (!as_machine_number(args[1], y))
+      {
+        return false;
+      }
+      if (op >= operation::equal)
+      {
+        result = sort_bool::bool_(compare(op, x, y));
+        return true;
+      }
+      return evaluate_binary(op, x, y, value) &&
+             from_machine_number(value, atermpp::down_cast<function_sort>(f.sort()).codomain(), result);
+    }
+
+  public:
+    /// \brief Returns true if applications of f to arity arguments are possibly evaluated by evaluate.
+    bool is_builtin(const function_symbol& f, std::size_t arity)
+    {
+      const operation op = get_operation(f);
+      return op != operation::none && arity == (is_unary(op) ? 1 : 2);
+    }
+
+    /// \brief Evaluates f(args[0], ..., args[arity-1]) if all arguments are numerals.
+    /// \param result Contains the normal form of the application if evaluation succeeds.
+    /// \return Whether the application could be evaluated.
+    /// \pre is_builtin(f, arity) and the arguments are in normal form.
+    bool evaluate(const function_symbol& f, const data_expression* args, std::size_t arity, data_expression& result)
+    {
+      const bool evaluated = evaluate_numerals(f, args, arity, result);
+      if (evaluated && m_evaluations_metric != nullptr)
+      {
+        m_evaluations_metric->add();
+      }
+      return evaluated;
+    }
+
+    /// \brief Evaluates f(x). Used by the code generated by the compiling rewriter.
+    bool evaluate(const function_symbol& f, const data_expression& x, data_expression& result)
+    {
+      return evaluate(f, &x, 1, result);
+    }
+
+    /// \brief Evaluates f(x, y). Used by the code generated by the compiling rewriter.
+    bool evaluate(const function_symbol& f, const data_expression& x, const data_expression& y, data_expression& result)
+    {
+      const data_expression args[] = { x, y };
+      return evaluate(f, args, 2, result);
+    }
+};
+
+} // namespace detail
+} // namespace data
+} // namespace mcrl2
+
+#endif // MCRL2_DATA_DETAIL_REWRITE_BUILTIN_ARITHMETIC_H
@@ -0,0 +1,263 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/data/detail/rewrite/indexed_strategy.h
+/// \brief A jitty strategy in which the rewrite rules are indexed on the head symbol of one of their arguments.
+
+#ifndef MCRL2_DATA_DETAIL_REWRITE_INDEXED_STRATEGY_H
+#define MCRL2_DATA_DETAIL_REWRITE_INDEXED_STRATEGY_H
+
+#include "mcrl2/data/detail/rewrite/jitty_jittyc.h"
+#include "mcrl2/data/detail/rewrite/strategy_rule.h"
+
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace mcrl2
+{
+namespace data
+{
+namespace detail
+{
+
+/// \brief A strategy of the jitty rewriter, in which consecutive rewrite rules with the same number of
+///        arguments are indexed on the head symbol of an argument that is already rewritten.
+/// \details For a mapping that is defined by a case distinction over many constructors, only the
+///          rewrite rules for the constructor that is the head of the rewritten argument are tried,
+///          instead of all rewrite rules in turn. The rules that can match are tried in the same order
+///          as in the original strategy, so the result of rewriting does not change.
+class indexed_strategy
+{
+  public:
+    typedef std::pair<const data_equation*, const data_equation*> rule_range;
+
+    /// \brief A step either rewrites an argument, or tries a sequence of rewrite rules with the same arity.
+    class step
+    {
+      public:
+        /// \brief Constructor for a step that rewrites argument i.
+        explicit step(std::size_t i)
+          : m_argument(i),
+            m_arity(0)
+        {}
+
+        /// \brief Constructor for a step that tries the given rules, each with the given arity.
+        /// \param rewritten The arguments that are rewritten by the preceding steps.
+        step(const std::vector<data_equation>& rules, std::size_t arity, const std::set<std::size_t>& rewritten)
+          : m_argument(npos()),
+            m_arity(arity)
+        {
+          assert(!rules.empty());
+          std::size_t max_keys = 0;
+          for (std::size_t i: rewritten)
+          {
+            if (i < arity)
+            {
+              const std::size_t keys = number_of_keys(rules, i);
+              if (keys > max_keys)
+              {
+                max_keys = keys;
+                m_argument = i;
+              }
+            }
+          }
+          if (max_keys < 2)
+          {
+            // Indexing does not exclude any rule.
+            m_argument = npos();
+            m_rules = rules;
+            m_other = std::make_pair(0, m_rules.size());
+            return;
+          }
+
+          // First the rules that match any head symbol, followed by a bucket for each head symbol.
+          for (const data_equation& rule: rules)
+          {
+            if (key(rule, m_argument) == npos())
+            {
+              m_rules.push_back(rule);
+            }
+          }
+          m_other = std::make_pair(0, m_rules.size());
+
+          std::set<std::size_t> keys;
+          for (const data_equation& rule: rules)
+          {
+            keys.insert(key(rule, m_argument));
+          }
+          keys.erase(npos());
+          m_buckets.resize(*keys.rbegin() + 1, m_other);
+          for (std::size_t k: keys)
+          {
+            const std::size_t begin = m_rules.size();
+            for (const data_equation& rule: rules)
+            {
+              const std::size_t rule_key = key(rule, m_argument);
+              if (rule_key == k || rule_key == npos())
+              {
+                m_rules.push_back(rule);
+              }
+            }
+            m_buckets[k] = std::make_pair(begin, m_rules.size());
+          }
+        }
+
+        bool is_rewrite_step() const
+        {
+          return m_rules.empty();
+        }
+
+        std::size_t rewrite_index() const
+        {
+          assert(is_rewrite_step());
+          return m_argument;
+        }
+
+        /// \brief The number of arguments of the rules in this step.
+        std::size_t arity() const
+        {
+          assert(!is_rewrite_step());
+          return m_arity;
+        }
+
+        /// \brief Indicates whether the rules are indexed on the head symbol of an argument.
+        bool is_indexed() const
+        {
+          return !is_rewrite_step() && m_argument != npos();
+        }
+
+        /// \brief The argument on which the rules are indexed.
+        std::size_t indexed_argument() const
+        {
+          assert(is_indexed());
+          return m_argument;
+        }
+
+        /// \brief Returns the rules that can match, in the order in which they must be tried.
+        /// \param arguments The arguments of the term. Only the indexed argument is inspected, which
+        ///                  must be in normal form.
+        rule_range candidates(const data_expression* arguments) const
+        {
+          std::pair<std::size_t, std::size_t> range = m_other;
+          if (is_indexed())
+          {
+            const std::size_t k = head_key(arguments[m_argument]);
+            if (k < m_buckets.size())
+            {
+              range = m_buckets[k];
+            }
+          }
+          return rule_range(m_rules.data() + range.first, m_rules.data() + range.second);
+        }
+
+      protected:
+        std::size_t m_argument; // The argument to rewrite, or the indexed argument, or npos().
+        std::size_t m_arity;
+        std::vector<data_equation> m_rules; // The buckets of rules that can match, stored consecutively.
+        std::vector<std::pair<std::size_t, std::size_t>> m_buckets; // The bucket for each head symbol, indexed by its index.
+        std::pair<std::size_t, std::size_t> m_other; // The rules that can match a term with another head symbol.
+
+        static constexpr std::size_t npos()
+        {
+          return std::numeric_limits<std::size_t>::max();
+        }
+
+        /// \brief Returns the index of the head symbol of t, or npos() if its head is not a function symbol.
+        static std::size_t head_key(const data_expression& t)
+        {
+          const data_expression& head = get_nested_head(t);
+          if (is_function_symbol(head))
+          {
+            return core::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(atermpp::down_cast<function_symbol>(head));
+          }
+          return npos();
+        }
+
+        /// \brief Returns the index of the head symbol that argument i of a term must have to match the rule,
+        ///        or npos() if the rule can match any head symbol.
+        static std::size_t key(const data_equation& rule, std::size_t i)
+        {
+          return head_key(get_argument_of_higher_order_term(atermpp::down_cast<application>(rule.lhs()), i));
+        }
+
+        static std::size_t number_of_keys(const std::vector<data_equation>& rules, std::size_t i)
+        {
+          std::set<std::size_t> keys;
+          for (const data_equation& rule: rules)
+          {
+            keys.insert(key(rule, i));
+          }
+          keys.erase(npos());
+          return keys.size();
+        }
+    };
+
+    indexed_strategy()
+      : m_number_of_variables(0)
+    {}
+
+    explicit indexed_strategy(const strategy& strat)
+      : m_number_of_variables(strat.number_of_variables())
+    {
+      std::set<std::size_t> rewritten;
+      std::vector<data_equation> rules;
+      std::size_t arity = 0;
+      for (const strategy_rule& rule: strat.rules())
+      {
+        if (rule.is_rewrite_index())
+        {
+          add_rules(rules, arity, rewritten);
+          m_steps.emplace_back(rule.rewrite_index());
+          rewritten.insert(rule.rewrite_index());
+        }
+        else
+        {
+          const data_expression& lhs = rule.equation().lhs();
+          const std::size_t rule_arity = (is_function_symbol(lhs) ? 0 : recursive_number_of_args(lhs));
+          if (rule_arity != arity)
+          {
+            add_rules(rules, arity, rewritten);
+            arity = rule_arity;
+          }
+          rules.push_back(rule.equation());
+        }
+      }
+      add_rules(rules, arity, rewritten);
+    }
+
+    std::size_t number_of_variables() const
+    {
+      return m_number_of_variables;
+    }
+
+    const std::vector<step>& steps() const
+    {
+      return m_steps;
+    }
+
+  protected:
+    std::size_t m_number_of_variables;
+    std::vector<step> m_steps;
+
+    void add_rules(std::vector<data_equation>& rules, std::size_t arity, const std::set<std::size_t>& rewritten)
+    {
+      if (!rules.empty())
+      {
+        m_steps.emplace_back(rules, arity, rewritten);
+        rules.clear();
+      }
+    }
+};
+
+} // namespace detail
+} // namespace data
+} // namespace mcrl2
+
+#endif // MCRL2_DATA_DETAIL_REWRITE_INDEXED_STRATEGY_H
@@ -11,7 +11,9 @@
 #define MCRL2_DATA_DETAIL_REWRITE_JITTY_H
 
 #include "mcrl2/data/detail/rewrite.h"
-#include "mcrl2/data/detail/rewrite/strategy_rule.h"
+#include "mcrl2/data/detail/rewrite_profile.h"
+#include "mcrl2/data/detail/rewrite/builtin_arithmetic.h"
+#include "mcrl2/data/detail/rewrite/indexed_strategy.h"
 
 namespace mcrl2
 {
@@ -35,8 +37,10 @@ class RewriterJitty: public Rewriter
     RewriterJitty& operator=(const RewriterJitty& other)=delete;
 
   private:
-    std::map< function_symbol, data_equation_list > jitty_eqns;
-    std::vector<strategy> jitty_strat;
+    std::vector<data_equation_list> jitty_eqns; // The rewrite rules, indexed by the index of their head symbol.
+    std::vector<indexed_strategy> jitty_strat;  // The strategies, indexed by the index of the head symbol.
+    std::unique_ptr<rewrite_profile> m_profile; // Only used with --profile-rewriting.
+    builtin_arithmetic m_builtin_arithmetic;
 
     data_expression rewrite_aux(const data_expression& term, substitution_type& sigma);
 
@@ -0,0 +1,200 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/data/detail/rewrite/jitty_strategy_store.h
+/// \brief Stores the strategies of the jitty rewriter, such that they can be reused and embedded in files.
+
+#ifndef MCRL2_DATA_DETAIL_REWRITE_JITTY_STRATEGY_STORE_H
+#define MCRL2_DATA_DETAIL_REWRITE_JITTY_STRATEGY_STORE_H
+
+#include "mcrl2/atermpp/aterm_io.h"
+#include "mcrl2/data/detail/io.h"
+#include "mcrl2/data/detail/rewrite/strategy_rule.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace mcrl2
+{
+namespace data
+{
+namespace detail
+{
+
+/// \brief Returns the flag that indicates whether the strategies of the jitty rewriter are embedded
+///        in the LPS and PBES files that are written.
+/// \details It is set by the option --embed-rewriter-state of tools that use a rewriter.
+inline
+bool& embed_rewriter_state()
+{
+  static bool embed = false;
+  return embed;
+}
+
+/// \brief Maps the rewrite rules of a function symbol to the strategy that the jitty rewriter
+///        computed for them.
+/// \details The rewrite rules themselves are the key, such that a stored strategy is only used for
+///          exactly the same rules. This makes it safe to use strategies that were read from a file,
+///          even if the data specification has changed since. The order of the rules is irrelevant,
+///          as it depends on the addresses of the equations in the term pool.
+class jitty_strategy_store
+{
+  public:
+    /// \brief Returns the strategy for the given rules, or nullptr if it is not stored.
+    const strategy* find(const data_equation_list& rules) const
+    {
+      auto i = m_strategies.find(canonical(rules));
+      return i == m_strategies.end() ? nullptr : &i->second;
+    }
+
+    void insert(const data_equation_list& rules, const strategy& strat)
+    {
+      m_strategies.emplace(canonical(rules), strat);
+    }
+
+    bool empty() const
+    {
+      return m_strategies.empty();
+    }
+
+    void clear()
+    {
+      m_strategies.clear();
+    }
+
+    /// \brief Writes the section with the stored strategies to the stream.
+    void write(atermpp::aterm_ostream& stream) const
+    {
+      atermpp::aterm_stream_state state(stream);
+      stream << remove_index_impl;
+
+      atermpp::aterm_list entries;
+      for (const auto& [rules, strat]: m_strategies)
+      {
+        entries.push_front(atermpp::aterm_appl(entry_symbol(), rules, atermpp::aterm_int(strat.number_of_variables()), strat.rules()));
+      }
+      stream << section_marker();
+      stream << entries;
+    }
+
+    /// \brief Reads a section with strategies written by write, if the stream contains one.
+    /// \details Entries that are not well formed are ignored.
+    void read(atermpp::aterm_istream& stream)
+    {
+      atermpp::aterm_stream_state state(stream);
+      stream >> add_index_impl;
+
+      atermpp::aterm marker;
+      stream >> marker;
+      if (marker != section_marker())
+      {
+        return;
+      }
+
+      atermpp::aterm entries;
+      stream >> entries;
+      if (!entries.type_is_list())
+      {
+        return;
+      }
+      for (const atermpp::aterm& entry: atermpp::down_cast<atermpp::aterm_list>(entries))
+      {
+        if (is_well_formed(entry))
+        {
+          const atermpp::aterm_appl& e = atermpp::down_cast<atermpp::aterm_appl>(entry);
+          insert(atermpp::down_cast<data_equation_list>(e[0]),
+                 strategy(atermpp::down_cast<atermpp::aterm_int>(e[1]).value(),
+                          atermpp::down_cast<atermpp::term_list<strategy_rule>>(e[2])));
+        }
+      }
+    }
+
+  protected:
+    std::unordered_map<data_equation_list, strategy, std::hash<atermpp::aterm>> m_strategies;
+
+    /// \brief Returns the rules in an order that only depends on the set of rules.
+    static data_equation_list canonical(const data_equation_list& rules)
+    {
+      std::vector<data_equation> result(rules.begin(), rules.end());
+      std::sort(result.begin(), result.end());
+      return data_equation_list(result.begin(), result.end());
+    }
+
+    static const atermpp::function_symbol& entry_symbol()
+    {
+      static atermpp::function_symbol f("jitty_strategy", 3);
+      return f;
+    }
+
+    static const atermpp::aterm_appl& section_marker()
+    {
+      static atermpp::aterm_appl marker(atermpp::function_symbol("jitty_strategies", 0));
+      return marker;
+    }
+
+    /// \brief Checks that the entry consists of rewrite rules, a number of variables, and a strategy that
+    ///        only applies the given rules.
+    static bool is_well_formed(const atermpp::aterm& entry)
+    {
+      if (!entry.type_is_appl() || atermpp::down_cast<atermpp::aterm_appl>(entry).function() != entry_symbol())
+      {
+        return false;
+      }
+      const atermpp::aterm_appl& e = atermpp::down_cast<atermpp::aterm_appl>(entry);
+      if (!e[0].type_is_list() || !e[1].type_is_int() || !e[2].type_is_list())
+      {
+        return false;
+      }
+      const atermpp::aterm_list& rules = atermpp::down_cast<atermpp::aterm_list>(e[0]);
+      if (!std::all_of(rules.begin(), rules.end(), [](const atermpp::aterm& x)
+                       {
+                         return x.type_is_appl() && atermpp::down_cast<atermpp::aterm_appl>(x).function() == core::detail::function_symbol_DataEqn();
+                       }))
+      {
+        return false;
+      }
+      const atermpp::aterm_list& strat = atermpp::down_cast<atermpp::aterm_list>(e[2]);
+      return std::all_of(strat.begin(), strat.end(), [&rules](const atermpp::aterm& x)
+               {
+                 return x.type_is_int() || std::find(rules.begin(), rules.end(), x) != rules.end();
+               });
+    }
+};
+
+/// \brief Returns the strategies of the jitty rewriter that have been computed or read in this process.
+inline
+jitty_strategy_store& jitty_strategies()
+{
+  static jitty_strategy_store store;
+  return store;
+}
+
+/// \brief Writes the stored jitty strategies to the stream, if this is enabled by embed_rewriter_state.
+/// \details It is called after writing an LPS or PBES, and readers that are not aware of it ignore the section.
+inline
+void write_rewriter_state(atermpp::aterm_ostream& stream)
+{
+  if (embed_rewriter_state() && !jitty_strategies().empty())
+  {
+    jitty_strategies().write(stream);
+  }
+}
+
+/// \brief Reads the jitty strategies written by write_rewriter_state, if the stream contains them.
+inline
+void read_rewriter_state(atermpp::aterm_istream& stream)
+{
+  jitty_strategies().read(stream);
+}
+
+} // namespace detail
+} // namespace data
+} // namespace mcrl2
+
+#endif // MCRL2_DATA_DETAIL_REWRITE_JITTY_STRATEGY_STORE_H
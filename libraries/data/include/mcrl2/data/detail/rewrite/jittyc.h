@@ -127,6 +127,9 @@ class RewriterCompilingJitty: public Rewriter
     std::vector<rewriter_function> functions_when_arguments_are_not_in_normal_form;
     std::vector<rewriter_function> functions_when_arguments_are_in_normal_form;
 
+    // Evaluates arithmetic on numerals in the generated code.
+    builtin_arithmetic m_builtin_arithmetic;
+
     // Standard assignment operator.
     RewriterCompilingJitty& operator=(const RewriterCompilingJitty& other)=delete;
 
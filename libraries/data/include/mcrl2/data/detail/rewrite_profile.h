@@ -0,0 +1,184 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/data/detail/rewrite_profile.h
+/// \brief Profiling information about the application of rewrite rules.
+
+#ifndef MCRL2_DATA_DETAIL_REWRITE_PROFILE_H
+#define MCRL2_DATA_DETAIL_REWRITE_PROFILE_H
+
+#include "mcrl2/data/data_equation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mcrl2
+{
+
+namespace data
+{
+
+namespace detail
+{
+
+/// \brief Returns the flag that indicates whether rewriters and the explorer collect profiling information.
+/// \details It is set by the option --profile-rewriting of tools that use a rewriter.
+inline
+bool& rewrite_profiling_enabled()
+{
+  static bool enabled = false;
+  return enabled;
+}
+
+/// \brief Converts a duration to seconds.
+inline
+double to_seconds(std::chrono::steady_clock::duration d)
+{
+  return std::chrono::duration<double>(d).count();
+}
+
+/// \brief Records how often rewrite rules are applied or fail to apply, and how much time is spent in
+///        rewriting terms per head symbol.
+class rewrite_profile
+{
+  public:
+    struct equation_statistics
+    {
+      std::size_t applied = 0;
+      std::size_t match_failures = 0;
+      std::size_t condition_failures = 0;
+    };
+
+    struct symbol_statistics
+    {
+      std::size_t calls = 0;
+      std::chrono::steady_clock::duration time = std::chrono::steady_clock::duration::zero(); ///< Excludes nested calls.
+    };
+
+    /// \brief Measures the time to rewrite a term with head symbol f, excluding the time of the nested
+    ///        measurements. It does nothing if the profile is nullptr.
+    class symbol_timer
+    {
+      public:
+        symbol_timer(rewrite_profile* profile, const function_symbol& f)
+          : m_profile(profile),
+            m_symbol(&f)
+        {
+          if (m_profile != nullptr)
+          {
+            m_profile->m_stack.emplace_back(std::chrono::steady_clock::now(), std::chrono::steady_clock::duration::zero());
+          }
+        }
+
+        ~symbol_timer()
+        {
+          if (m_profile != nullptr)
+          {
+            m_profile->finish(*m_symbol);
+          }
+        }
+
+        symbol_timer(const symbol_timer&) = delete;
+        symbol_timer& operator=(const symbol_timer&) = delete;
+
+      private:
+        rewrite_profile* m_profile;
+        const function_symbol* m_symbol;
+    };
+
+    void applied(const data_equation& eq)
+    {
+      m_equations[eq].applied++;
+    }
+
+    void match_failed(const data_equation& eq)
+    {
+      m_equations[eq].match_failures++;
+    }
+
+    void condition_failed(const data_equation& eq)
+    {
+      m_equations[eq].condition_failures++;
+    }
+
+    bool empty() const
+    {
+      return m_equations.empty() && m_symbols.empty();
+    }
+
+    /// \brief Prints the equations sorted by the number of applications, and the head symbols sorted by time.
+    /// \param max_entries The maximal number of equations and head symbols that are printed.
+    void report(std::ostream& out, std::size_t max_entries = 25) const
+    {
+      std::vector<std::pair<data_equation, equation_statistics>> equations(m_equations.begin(), m_equations.end());
+      std::sort(equations.begin(), equations.end(), [](const auto& x, const auto& y) { return x.second.applied > y.second.applied; });
+
+      out << "Rewrite rules, sorted by the number of applications:\n"
+          << std::setw(12) << "applied" << std::setw(12) << "no match" << std::setw(12) << "false cond" << "  equation\n";
+      for (std::size_t i = 0; i < equations.size() && i < max_entries; ++i)
+      {
+        const equation_statistics& s = equations[i].second;
+        out << std::setw(12) << s.applied << std::setw(12) << s.match_failures << std::setw(12) << s.condition_failures
+            << "  " << data::pp(equations[i].first) << "\n";
+      }
+      print_omitted(out, equations.size(), max_entries);
+
+      std::vector<std::pair<function_symbol, symbol_statistics>> symbols(m_symbols.begin(), m_symbols.end());
+      std::sort(symbols.begin(), symbols.end(), [](const auto& x, const auto& y) { return x.second.time > y.second.time; });
+
+      out << "Head symbols, sorted by the time spent in rewriting terms with that head symbol:\n"
+          << std::setw(12) << "calls" << std::setw(12) << "seconds" << "  symbol\n";
+      for (std::size_t i = 0; i < symbols.size() && i < max_entries; ++i)
+      {
+        const symbol_statistics& s = symbols[i].second;
+        out << std::setw(12) << s.calls << std::setw(12) << std::fixed << std::setprecision(6) << to_seconds(s.time)
+            << "  " << data::pp(symbols[i].first) << ": " << data::pp(symbols[i].first.sort()) << "\n";
+      }
+      print_omitted(out, symbols.size(), max_entries);
+    }
+
+  protected:
+    std::unordered_map<data_equation, equation_statistics, std::hash<atermpp::aterm_appl>> m_equations;
+    std::unordered_map<function_symbol, symbol_statistics, std::hash<atermpp::aterm_appl>> m_symbols;
+
+    // The start times of the active measurements, with the time spent in their nested measurements.
+    std::vector<std::pair<std::chrono::steady_clock::time_point, std::chrono::steady_clock::duration>> m_stack;
+
+    void finish(const function_symbol& f)
+    {
+      auto elapsed = std::chrono::steady_clock::now() - m_stack.back().first;
+      symbol_statistics& s = m_symbols[f];
+      s.calls++;
+      s.time += elapsed - m_stack.back().second;
+      m_stack.pop_back();
+      if (!m_stack.empty())
+      {
+        m_stack.back().second += elapsed;
+      }
+    }
+
+    static void print_omitted(std::ostream& out, std::size_t size, std::size_t max_entries)
+    {
+      if (size > max_entries)
+      {
+        out << "  (" << size - max_entries << " more)\n";
+      }
+    }
+};
+
+} // namespace detail
+
+} // namespace data
+
+} // namespace mcrl2
+
+#endif // MCRL2_DATA_DETAIL_REWRITE_PROFILE_H
@@ -19,6 +19,8 @@
 #include "mcrl2/utilities/math.h"
 #include <boost/iterator/iterator_facade.hpp>
 #include <deque>
+#include <memory>
+#include <vector>
 
 namespace mcrl2
 {
@@ -237,26 +239,26 @@ class enumerator_list_element
     enumerator_list_element() = default;
 
     /// \brief Constructs the element (v, phi)
-    enumerator_list_element(data::variable_list v_, const Expression& phi_)
-      : v(std::move(v_)), phi(phi_)
+    enumerator_list_element(data::variable_list v_, Expression phi_)
+      : v(std::move(v_)), phi(std::move(phi_))
     {}
 
     /// \brief Constructs the element (v, phi)
     enumerator_list_element(data::variable_list v_,
-                            const Expression& phi_,
+                            Expression phi_,
                             const enumerator_list_element&
                            )
-      : v(std::move(v_)), phi(phi_)
+      : v(std::move(v_)), phi(std::move(phi_))
     {}
 
     /// \brief Constructs the element (v, phi)
     enumerator_list_element(data::variable_list v_,
-                            const Expression& phi_,
+                            Expression phi_,
                             const enumerator_list_element&,
                             const data::variable&,
                             const data::data_expression&
                            )
-      : v(std::move(v_)), phi(phi_)
+      : v(std::move(v_)), phi(std::move(phi_))
     {}
 
     const data::variable_list& variables() const
@@ -309,16 +311,16 @@ class enumerator_list_element_with_substitution: public enumerator_list_element<
     enumerator_list_element_with_substitution() = default;
 
     /// \brief Constructs the element (v, phi, [])
-    enumerator_list_element_with_substitution(const data::variable_list& v, const Expression& phi)
-      : enumerator_list_element<Expression>(v, phi)
+    enumerator_list_element_with_substitution(data::variable_list v, Expression phi)
+      : enumerator_list_element<Expression>(std::move(v), std::move(phi))
     {}
 
     /// \brief Constructs the element (v, phi, e.sigma[v := x])
-    enumerator_list_element_with_substitution(const data::variable_list& v,
-                            const Expression& phi,
+    enumerator_list_element_with_substitution(data::variable_list v,
+                            Expression phi,
                             const enumerator_list_element_with_substitution<Expression>& elem
                            )
-      : enumerator_list_element<Expression>(v, phi),
+      : enumerator_list_element<Expression>(std::move(v), std::move(phi)),
         m_variables(elem.m_variables),
         m_expressions(elem.m_expressions)
     {
@@ -326,13 +328,13 @@ class enumerator_list_element_with_substitution: public enumerator_list_element<
 
     /// \brief Constructs the element (v, phi, e.sigma[v := x])
     enumerator_list_element_with_substitution(
-                            const data::variable_list& v,
-                            const Expression& phi,
+                            data::variable_list v,
+                            Expression phi,
                             const enumerator_list_element_with_substitution<Expression>& elem,
                             const data::variable& d,
                             const data::data_expression& e
                            )
-      : enumerator_list_element<Expression>(v, phi),
+      : enumerator_list_element<Expression>(std::move(v), std::move(phi)),
         m_variables(elem.m_variables),
         m_expressions(elem.m_expressions)
     {
@@ -437,6 +439,14 @@ class enumerator_queue
       P.push_back(x);
     }
 
+    void push_back(EnumeratorListElement&& x)
+    {
+#ifdef MCRL2_LOG_ENUMERATOR
+      std::cout << "push_back " << x << std::endl;
+#endif
+      P.push_back(std::move(x));
+    }
+
     template <class... Args>
     void emplace_back(Args&&... args)
     {
@@ -490,8 +500,64 @@ class enumerator_queue
     {
       P.pop_back();
     }
+
+    /// \brief Moves the last element of the queue to the front.
+    void move_back_to_front()
+    {
+      P.push_front(std::move(P.back()));
+      P.pop_back();
+    }
 };
 
+namespace detail
+{
+
+/// \brief A pool of empty enumerator queues. Taking a queue from the pool instead of creating a new one
+/// avoids allocating the blocks of a std::deque in every enumeration.
+template <typename EnumeratorListElement>
+class enumerator_queue_pool
+{
+  protected:
+    std::vector<std::unique_ptr<enumerator_queue<EnumeratorListElement>>> m_queues;
+
+  public:
+    std::unique_ptr<enumerator_queue<EnumeratorListElement>> acquire()
+    {
+      if (m_queues.empty())
+      {
+        return std::make_unique<enumerator_queue<EnumeratorListElement>>();
+      }
+      std::unique_ptr<enumerator_queue<EnumeratorListElement>> result = std::move(m_queues.back());
+      m_queues.pop_back();
+      return result;
+    }
+
+    /// \brief Returns the number of queues in the pool.
+    std::size_t size() const
+    {
+      return m_queues.size();
+    }
+
+    /// \brief Returns the queue P to the pool. Remaining elements of P are removed.
+    void release(std::unique_ptr<enumerator_queue<EnumeratorListElement>> P)
+    {
+      P->clear();
+      m_queues.push_back(std::move(P));
+    }
+};
+
+/// \brief Returns the pool of queues that is used by enumerator_algorithm::enumerate.
+/// \details A pool contains more than one queue if enumerations are nested, for instance when a
+/// solution is reported while enumerating another expression.
+template <typename EnumeratorListElement>
+enumerator_queue_pool<EnumeratorListElement>& enumerator_queues()
+{
+  thread_local enumerator_queue_pool<EnumeratorListElement> pool;
+  return pool;
+}
+
+} // namespace detail
+
 /// \brief An enumerator algorithm that generates solutions of a condition.
 template <typename Rewriter = data::rewriter, typename DataRewriter = data::rewriter>
 class enumerator_algorithm
@@ -515,6 +581,9 @@ class enumerator_algorithm
     /// \brief If true, solutions with a non-empty list of variables may be reported.
     bool m_accept_solutions_with_variables;
 
+    /// \brief If the todo list contains more elements, the most recently added element is enumerated first.
+    std::size_t m_max_queue_size;
+
 #ifdef MCRL2_ENUMERATOR_COUNT_REWRITE_CALLS
     mutable std::size_t rewrite_calls = 0;
 #endif
@@ -549,7 +618,8 @@ class enumerator_algorithm
         r(datar_),
         id_generator(id_generator_),
         m_max_count(max_count),
-        m_accept_solutions_with_variables(accept_solutions_with_variables)
+        m_accept_solutions_with_variables(accept_solutions_with_variables),
+        m_max_queue_size(detail::get_enumerator_queue_limit())
     {}
 
     enumerator_algorithm(const enumerator_algorithm<Rewriter, DataRewriter>&) = delete;
@@ -609,10 +679,10 @@ class enumerator_algorithm
         }
         if ((accept(phi1) && m_accept_solutions_with_variables) || variables.empty())
         {
-          EnumeratorListElement q(variables, phi1, p, v, e);
+          EnumeratorListElement q(variables, std::move(phi1), p, v, e);
           return report_solution(q);
         }
-        P.emplace_back(variables, phi1, p, v, e);
+        P.emplace_back(variables, std::move(phi1), p, v, e);
         return false;
       };
 
@@ -631,16 +701,16 @@ class enumerator_algorithm
         bool added_variables_empty = added_variables.empty() || (phi1 == phi && m_accept_solutions_with_variables);
         if ((accept(phi1) && m_accept_solutions_with_variables) || (variables.empty() && added_variables_empty))
         {
-          EnumeratorListElement q(variables + added_variables, phi1, p, v, e);
+          EnumeratorListElement q(variables + added_variables, std::move(phi1), p, v, e);
           return report_solution(q);
         }
         if (added_variables_empty)
         {
-          P.emplace_back(variables, phi1, p, v, e);
+          P.emplace_back(variables, std::move(phi1), p, v, e);
         }
         else
         {
-          P.emplace_back(variables + added_variables, phi1, p, v, e);
+          P.emplace_back(variables + added_variables, std::move(phi1), p, v, e);
         }
         return false;
       };
@@ -655,7 +725,7 @@ class enumerator_algorithm
         {
           return false;
         }
-        EnumeratorListElement q(v, phi1, p);
+        EnumeratorListElement q(v, std::move(phi1), p);
         return report_solution(q);
       }
 
@@ -792,6 +862,9 @@ class enumerator_algorithm
 
     /// \brief Enumerates until P is empty. Solutions are reported using the callback function report_solution.
     /// The enumeration is interrupted when report_solution returns true for the reported solution.
+    /// Elements are enumerated breadth first. If P contains more than max_queue_size() elements,
+    /// the most recently added element is enumerated first, such that the size of P stays bounded
+    /// for large domains. This only changes the order in which solutions are reported.
     /// \param P The todo list of the algorithm.
     /// \param sigma A substitution.
     /// \param reject Elements p for which reject(p) is true are discarded.
@@ -822,6 +895,10 @@ class enumerator_algorithm
         {
           break;
         }
+        if (P.size() > m_max_queue_size)
+        {
+          P.move_back_to_front();
+        }
         if (enumerate_front(P, sigma, report_solution, reject, accept))
         {
           break;
@@ -856,14 +933,28 @@ class enumerator_algorithm
                           Accept accept = Accept()
     ) const
     {
-      enumerator_queue<EnumeratorListElement> P(p);
-      return enumerate_all(P, sigma, report_solution, reject, accept);
+      auto& queues = detail::enumerator_queues<EnumeratorListElement>();
+      std::unique_ptr<enumerator_queue<EnumeratorListElement>> P = queues.acquire();
+      P->push_back(p);
+      const std::size_t result = enumerate_all(*P, sigma, report_solution, reject, accept);
+      queues.release(std::move(P));
+      return result;
     }
 
     std::size_t max_count() const
     {
       return m_max_count;
     }
+
+    std::size_t max_queue_size() const
+    {
+      return m_max_queue_size;
+    }
+
+    void set_max_queue_size(std::size_t size)
+    {
+      m_max_queue_size = size;
+    }
 };
 
 /// \brief Returns a vector with all expressions of sort s.
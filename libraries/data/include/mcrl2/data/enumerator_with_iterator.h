@@ -74,7 +74,7 @@ class enumerator_algorithm_without_callback: public enumerator_algorithm<Rewrite
       auto phi1 = rewrite(phi, sigma);
       if (accept(phi1))
       {
-        P.push_back(EnumeratorListElement(variables, phi1, p, v, e));
+        P.push_back(EnumeratorListElement(variables, std::move(phi1), p, v, e));
       }
     }
 
@@ -94,7 +94,7 @@ class enumerator_algorithm_without_callback: public enumerator_algorithm<Rewrite
       if (accept(phi1))
       {
         // Additional variables are put at the end of the list!
-        P.push_back(EnumeratorListElement(variables + added_variables, phi1, p, v, e));
+        P.push_back(EnumeratorListElement(variables + added_variables, std::move(phi1), p, v, e));
       }
     }
 
@@ -117,12 +117,12 @@ class enumerator_algorithm_without_callback: public enumerator_algorithm<Rewrite
         if (phi1 == phi)
         {
           // Discard the added_variables, since we know they do not appear in phi1
-          P.push_back(enumerator_list_element<Expression>(variables, phi1, p, v, e));
+          P.push_back(enumerator_list_element<Expression>(variables, std::move(phi1), p, v, e));
         }
         else
         {
           // Additional variables are put at the end of the list!
-          P.push_back(enumerator_list_element<Expression>(variables + added_variables, phi1, p, v, e));
+          P.push_back(enumerator_list_element<Expression>(variables + added_variables, std::move(phi1), p, v, e));
         }
         //mCRL2log(log::debug) << "  <add-element> " << P.back() << " with assignment " << v << " := " << e << std::endl;
       }
@@ -157,7 +157,7 @@ class enumerator_algorithm_without_callback: public enumerator_algorithm<Rewrite
     {
       assert(!P.empty());
 
-      auto p = P.front();
+      auto p = std::move(P.front());
       const auto& v = p.variables();
       const auto& phi = p.expression();
       //mCRL2log(log::debug) << "  <process-element> " << p << std::endl;
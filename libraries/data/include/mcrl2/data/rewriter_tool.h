@@ -13,6 +13,8 @@
 #define MCRL2_DATA_REWRITER_TOOL_H
 
 #include "mcrl2/data/detail/enumerator_iteration_limit.h"
+#include "mcrl2/data/detail/rewrite/jitty_strategy_store.h"
+#include "mcrl2/data/detail/rewrite_profile.h"
 #include "mcrl2/data/rewriter.h"
 #include "mcrl2/utilities/command_line_interface.h"
 
@@ -65,6 +67,32 @@ class rewriter_tool: public Tool
         'Q'
       );
 
+      desc.add_option(
+        "enumeration-queue-limit",
+        utilities::make_mandatory_argument("NUM"),
+        "enumerate depth first when more than NUM partially enumerated terms are pending, such that "
+        "the memory use for large domains stays bounded. This changes the order in which solutions are "
+        "found. (Default NUM=1000000, NUM=0 for unlimited)."
+      );
+
+      desc.add_option(
+        "normal-form-cache",
+        utilities::make_mandatory_argument("NUM"),
+        "cache the normal forms of at most NUM closed terms in the rewriter. This avoids rewriting "
+        "guards and updates that recur in many states again. (Default NUM=0, which disables the cache)."
+      );
+
+      desc.add_option(
+        "embed-rewriter-state",
+        "embed the strategies of the jitty rewriter in the LPS or PBES that is written, such that "
+        "tools that read it do not have to compute them again."
+      );
+
+      desc.add_option(
+        "profile-rewriting",
+        "report how often each rewrite rule is applied or fails to apply, the time spent per head symbol, "
+        "and, when generating a state space, the time and number of transitions per summand."
+      );
     }
 
     /// \brief Add options to an interface description. Also includes
@@ -89,6 +117,20 @@ class rewriter_tool: public Tool
         std::size_t qlimit = parser.option_argument_as< std::size_t >("qlimit");
         data::detail::set_enumerator_iteration_limit(qlimit == 0 ? std::numeric_limits<std::size_t>::max() : qlimit);
       }
+
+      if (parser.has_option("enumeration-queue-limit"))
+      {
+        std::size_t limit = parser.option_argument_as<std::size_t>("enumeration-queue-limit");
+        data::detail::set_enumerator_queue_limit(limit == 0 ? std::numeric_limits<std::size_t>::max() : limit);
+      }
+
+      if (parser.has_option("normal-form-cache"))
+      {
+        data::detail::normal_form_cache_size() = parser.option_argument_as<std::size_t>("normal-form-cache");
+      }
+
+      data::detail::embed_rewriter_state() = parser.has_option("embed-rewriter-state");
+      data::detail::rewrite_profiling_enabled() = parser.has_option("profile-rewriting");
     }
 
   public:
@@ -9,6 +9,7 @@
 
 #include "mcrl2/data/detail/rewrite/jitty.h"
 #include "mcrl2/data/detail/rewrite/jitty_jittyc.h"
+#include "mcrl2/data/detail/rewrite/jitty_strategy_store.h"
 
 #define NAME std::string("rewr_jitty")
 
@@ -150,11 +151,27 @@ void RewriterJitty::make_jitty_strat_sufficiently_larger(const std::size_t i)
 void RewriterJitty::rebuild_strategy()
 {
   jitty_strat.clear();
-  for(std::map< function_symbol, data_equation_list >::const_iterator l=jitty_eqns.begin(); l!=jitty_eqns.end(); ++l)
+  for (std::size_t i=0; i<jitty_eqns.size(); ++i)
   {
-    const std::size_t i=core::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(l->first);
+    if (jitty_eqns[i].empty())
+    {
+      continue;
+    }
     make_jitty_strat_sufficiently_larger(i);
-    jitty_strat[i] = create_strategy(reverse(l->second));
+
+    // Strategies are computed once per set of rewrite rules, or read from a file.
+    const data_equation_list rules = reverse(jitty_eqns[i]);
+    const strategy* stored = jitty_strategies().find(rules);
+    if (stored == nullptr)
+    {
+      const strategy strat = create_strategy(rules);
+      jitty_strategies().insert(rules, strat);
+      jitty_strat[i] = indexed_strategy(strat);
+    }
+    else
+    {
+      jitty_strat[i] = indexed_strategy(*stored);
+    }
   }
 }
 
@@ -177,24 +194,32 @@ RewriterJitty::RewriterJitty(
         continue;
       }
 
-      const function_symbol& lhs_head_index=atermpp::down_cast<function_symbol>(get_nested_head(eq.lhs()));
-
-      data_equation_list n;
-      std::map< function_symbol, data_equation_list >::iterator it = jitty_eqns.find(lhs_head_index);
-      if (it != jitty_eqns.end())
+      const function_symbol& lhs_head=atermpp::down_cast<function_symbol>(get_nested_head(eq.lhs()));
+      const std::size_t i=core::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(lhs_head);
+      if (i>=jitty_eqns.size())
       {
-        n = it->second;
+        jitty_eqns.resize(i+1);
       }
-      n.push_front(eq);
-      jitty_eqns[lhs_head_index] = n;
+      jitty_eqns[i].push_front(eq);
     }
   }
 
   rebuild_strategy();
+
+  if (rewrite_profiling_enabled())
+  {
+    m_profile.reset(new rewrite_profile());
+  }
 }
 
 RewriterJitty::~RewriterJitty()
 {
+  if (m_profile != nullptr && !m_profile->empty())
+  {
+    std::ostringstream out;
+    m_profile->report(out);
+    mCRL2log(info) << out.str();
+  }
 }
 
 static data_expression subst_values(
@@ -464,6 +489,7 @@ data_expression RewriterJitty::rewrite_aux_function_symbol(
                       substitution_type& sigma)
 {
   // The first term is function symbol; apply the necessary rewrite rules using a jitty strategy.
+  rewrite_profile::symbol_timer timer(m_profile.get(), op);
 
   const std::size_t arity=(is_function_symbol(term)?0:detail::recursive_number_of_args(term));
 
@@ -475,22 +501,41 @@ data_expression RewriterJitty::rewrite_aux_function_symbol(
     rewritten_defined[i]=false;
   }
 
+  // Arithmetic on numerals is evaluated using machine integers. The arguments are rewritten first,
+  // and if they are not all numerals the rewrite rules below are applied to these normal forms.
+  if (m_builtin_arithmetic.is_builtin(op,arity))
+  {
+    for (std::size_t i=0; i<arity; i++)
+    {
+      new (&rewritten[i]) data_expression(rewrite_aux(detail::get_argument_of_higher_order_term(atermpp::down_cast<application>(term),i),sigma));
+      rewritten_defined[i]=true;
+    }
+    data_expression result;
+    if (m_builtin_arithmetic.evaluate(op,rewritten,arity,result))
+    {
+      for (std::size_t i=0; i<arity; i++)
+      {
+        rewritten[i].~data_expression();
+      }
+      return result;
+    }
+  }
+
   const std::size_t op_value=core::index_traits<data::function_symbol,function_symbol_key_type, 2>::index(op);
   make_jitty_strat_sufficiently_larger(op_value);
-  const strategy& strat=jitty_strat[op_value];
+  const indexed_strategy& strat=jitty_strat[op_value];
 
-  if (!strat.rules().empty())
+  if (!strat.steps().empty())
   {
     jitty_assignments_for_a_rewrite_rule assignments(MCRL2_SPECIFIC_STACK_ALLOCATOR(jitty_variable_assignment_for_a_rewrite_rule, strat.number_of_variables()));
 
-    for (const strategy_rule& rule : strat.rules())
+    for (const indexed_strategy::step& step : strat.steps())
     {
-      if (rule.is_rewrite_index())
+      if (step.is_rewrite_step())
       {
-        const std::size_t i = rule.rewrite_index();
+        const std::size_t i = step.rewrite_index();
         if (i < arity)
         {
-          assert(!rewritten_defined[i]||i==0);
           if (!rewritten_defined[i])
           {
             new (&rewritten[i]) data_expression(rewrite_aux(detail::get_argument_of_higher_order_term(atermpp::down_cast<application>(term),i),sigma));
@@ -502,17 +547,22 @@ data_expression RewriterJitty::rewrite_aux_function_symbol(
         {
           break;
         }
+        continue;
       }
-      else
+
+      const std::size_t rule_arity = step.arity();
+      if (rule_arity > arity)
       {
-        const data_equation& rule1=rule.equation();
-        const data_expression& lhs=rule1.lhs();
-        std::size_t rule_arity = (is_function_symbol(lhs)?0:detail::recursive_number_of_args(lhs));
+        break;
+      }
 
-        if (rule_arity > arity)
-        {
-          break;
-        }
+      // Only the rules that can match the head symbol of the indexed argument are tried.
+      assert(!step.is_indexed() || rewritten_defined[step.indexed_argument()]);
+      const indexed_strategy::rule_range candidates = step.candidates(rewritten);
+      for (const data_equation* rule = candidates.first; rule != candidates.second; ++rule)
+      {
+        const data_equation& rule1=*rule;
+        const data_expression& lhs=rule1.lhs();
 
         assert(assignments.size==0);
 
@@ -533,6 +583,10 @@ data_expression RewriterJitty::rewrite_aux_function_symbol(
           if (rule1.condition()==sort_bool::true_() || rewrite_aux(
                    subst_values(assignments,rule1.condition(),m_generator),sigma)==sort_bool::true_())
           {
+            if (m_profile != nullptr)
+            {
+              m_profile->applied(rule1);
+            }
             const data_expression& rhs=rule1.rhs();
 
             if (arity == rule_arity)
@@ -590,6 +644,14 @@ data_expression RewriterJitty::rewrite_aux_function_symbol(
               return rewrite_aux(result,sigma);
             }
           }
+          else if (m_profile != nullptr)
+          {
+            m_profile->condition_failed(rule1);
+          }
+        }
+        else if (m_profile != nullptr)
+        {
+          m_profile->match_failed(rule1);
         }
         assignments.size=0;
       }
@@ -637,29 +699,33 @@ data_expression RewriterJitty::rewrite_aux_const_function_symbol(
 
   const std::size_t op_value=core::index_traits<data::function_symbol,function_symbol_key_type, 2>::index(op);
   make_jitty_strat_sufficiently_larger(op_value);
-  const strategy& strat=jitty_strat[op_value];
+  const indexed_strategy& strat=jitty_strat[op_value];
 
-  for (const strategy_rule& rule : strat.rules())
+  for (const indexed_strategy::step& step : strat.steps())
   {
-    if (rule.is_rewrite_index())
+    if (step.is_rewrite_step() || step.arity() > 0)
     {
       break;
     }
-    else
-    {
-      const data_equation& rule1=rule.equation();
-      const data_expression& lhs=rule1.lhs();
-      std::size_t rule_arity = (is_function_symbol(lhs)?0:detail::recursive_number_of_args(lhs));
 
-      if (rule_arity > 0)
-      {
-        break;
-      }
+    // Rules without arguments are not indexed.
+    const indexed_strategy::rule_range candidates = step.candidates(nullptr);
+    for (const data_equation* rule = candidates.first; rule != candidates.second; ++rule)
+    {
+      const data_equation& rule1=*rule;
 
       if (rule1.condition()==sort_bool::true_() || rewrite_aux(rule1.condition(),sigma)==sort_bool::true_())
       {
+        if (m_profile != nullptr)
+        {
+          m_profile->applied(rule1);
+        }
         return rewrite_aux(rule1.rhs(),sigma);
       }
+      else if (m_profile != nullptr)
+      {
+        m_profile->condition_failed(rule1);
+      }
     }
   }
 
@@ -674,7 +740,9 @@ data_expression RewriterJitty::rewrite(
 #ifdef MCRL2_DISPLAY_REWRITE_STATISTICS
   data::detail::increment_rewrite_count();
 #endif
-  const data_expression& t=rewrite_aux(term, sigma);
+  count_rewrite_call();
+  const data_expression& t = m_normal_form_cache == nullptr ? rewrite_aux(term, sigma)
+                             : rewrite_with_normal_form_cache(term, sigma, [&]() { return rewrite_aux(term, sigma); });
   assert(remove_normal_form_function(t)==t);
   return t;
 }
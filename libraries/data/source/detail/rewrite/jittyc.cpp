@@ -2199,6 +2199,67 @@ public:
     }
   }
 
+  ///
+  /// \brief rewrite_argument generates code that rewrites argument arg to normal form, if
+  ///        this has not been done yet, and makes it available as arg<arg>.
+  ///
+  void rewrite_argument(
+             std::ostream& m_stream,
+             std::size_t arg,
+             bracket_level_data& brackets,
+             bool& added_new_parameters_in_brackets)
+  {
+    if (!m_used[arg])
+    {
+      m_stream << m_padding << "const data_expression& arg" << arg << " = local_rewrite(arg_not_nf" << arg << ",this_rewriter);\n";
+      m_used[arg] = true;
+      if (!added_new_parameters_in_brackets)
+      {
+        added_new_parameters_in_brackets=true;
+        brackets.current_data_parameters.push(brackets.current_data_parameters.top()); 
+        brackets.current_data_arguments.push(brackets.current_data_arguments.top()); 
+      }
+      const std::string& parameters=brackets.current_data_parameters.top();
+      brackets.current_data_parameters.top()=parameters + (parameters.empty()?"":", ") + "const data_expression& arg" + std::to_string(arg);
+      const std::string arguments = brackets.current_data_arguments.top();
+      brackets.current_data_arguments.top()=arguments + (arguments.empty()?"":", ") + "arg" + std::to_string(arg);
+    }
+  }
+
+  ///
+  /// \brief implement_builtin_arithmetic generates code that evaluates arithmetic on numerals
+  ///        using machine integers, see builtin_arithmetic. All arguments are rewritten first.
+  ///        If they are not all numerals, the code of the rewrite rules follows.
+  ///
+  void implement_builtin_arithmetic(
+             std::ostream& m_stream,
+             std::size_t arity,
+             const function_symbol& opid,
+             bracket_level_data& brackets,
+             bool& added_new_parameters_in_brackets)
+  {
+    for (std::size_t arg = 0; arg < arity; ++arg)
+    {
+      rewrite_argument(m_stream, arg, brackets, added_new_parameters_in_brackets);
+    }
+    m_stream << m_padding << "{\n";
+    m_padding.indent();
+    m_stream << m_padding << "data_expression builtin_result;\n"
+             << m_padding << "if (this_rewriter->m_builtin_arithmetic.evaluate("
+             << "atermpp::down_cast<function_symbol>(atermpp::aterm(reinterpret_cast<atermpp::detail::_aterm*>("
+             << (void*)atermpp::detail::address(opid) << ")))";
+    for (std::size_t arg = 0; arg < arity; ++arg)
+    {
+      m_stream << ", arg" << arg;
+    }
+    m_stream << ", builtin_result))\n"
+             << m_padding << "{\n"
+             << m_padding << "  return builtin_result;\n"
+             << m_padding << "}\n";
+    m_padding.unindent();
+    m_stream << m_padding << "}\n";
+  }
+
   void implement_strategy(
              std::ostream& m_stream, 
              match_tree_list strat, 
@@ -2211,27 +2272,17 @@ public:
     m_used=nfs_array(arity); // This vector maintains which arguments are in normal form.
     // m_nnfvars=variable_or_number_list();
     std::map<variable,std::string> type_of_code_variables;
+    if (m_rewriter.m_builtin_arithmetic.is_builtin(opid, arity))
+    {
+      implement_builtin_arithmetic(m_stream, arity, opid, brackets, added_new_parameters_in_brackets);
+    }
     while (!strat.empty())
     {
       m_stream << m_padding << "// " << strat.front() <<  "\n";
       if (strat.front().isA())
       {
         std::size_t arg = match_tree_A(strat.front()).variable_index();
-        if (!m_used[arg])
-        {
-          m_stream << m_padding << "const data_expression& arg" << arg << " = local_rewrite(arg_not_nf" << arg << ",this_rewriter);\n";
-          m_used[arg] = true;
-          if (!added_new_parameters_in_brackets)
-          {
-            added_new_parameters_in_brackets=true;
-            brackets.current_data_parameters.push(brackets.current_data_parameters.top()); 
-            brackets.current_data_arguments.push(brackets.current_data_arguments.top()); 
-          }
-          const std::string& parameters=brackets.current_data_parameters.top();
-          brackets.current_data_parameters.top()=parameters + (parameters.empty()?"":", ") + "const data_expression& arg" + std::to_string(arg);
-          const std::string arguments = brackets.current_data_arguments.top();
-          brackets.current_data_arguments.top()=arguments + (arguments.empty()?"":", ") + "arg" + std::to_string(arg);
-        }
+        rewrite_argument(m_stream, arg, brackets, added_new_parameters_in_brackets);
         m_stream << m_padding << "// Considering argument " << arg << "\n";
       }
       else
@@ -2871,6 +2922,13 @@ RewriterCompilingJitty::RewriterCompilingJitty(
   }
 
   BuildRewriteSystem();
+
+  if (rewrite_profiling_enabled())
+  {
+    // The generated match trees combine the rewrite rules of a function symbol, such that the
+    // compiled code cannot tell which rule is applied.
+    mCRL2log(warning) << "The compiling rewriter does not collect rewrite rule statistics; use the jitty rewriter with --profile-rewriting instead." << std::endl;
+  }
 }
 
 RewriterCompilingJitty::~RewriterCompilingJitty()
@@ -2885,11 +2943,13 @@ data_expression RewriterCompilingJitty::rewrite(
 #ifdef MCRL2_DISPLAY_REWRITE_STATISTICS
   data::detail::increment_rewrite_count();
 #endif
+  count_rewrite_call();
   // Save global sigma and restore it afterwards, as rewriting might be recursive with different
   // substitutions, due to the enumerator.
   substitution_type *saved_sigma=global_sigma;
   global_sigma=&sigma;
-  const data_expression& result=so_rewr(term, this);
+  const data_expression& result = m_normal_form_cache == nullptr ? so_rewr(term, this)
+                                  : rewrite_with_normal_form_cache(term, sigma, [&]() { return so_rewr(term, this); });
   global_sigma=saved_sigma;
   return result;
 }
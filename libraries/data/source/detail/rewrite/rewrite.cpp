@@ -455,6 +455,8 @@ std::shared_ptr<Rewriter> createRewriter(
             const used_data_equation_selector& equations_selector,
             const rewrite_strategy strategy)
 {
+  // The construction includes the compilation of the rewrite system for the compiling rewriters.
+  utilities::metrics_phase phase("rewriter.construction");
   switch (strategy)
   {
     case jitty:
@@ -0,0 +1,66 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file bdd_path_eliminator_test.cpp
+/// \brief Test for the elimination of inconsistent paths from BDDs.
+
+#define BOOST_TEST_MODULE bdd_path_eliminator_test
+#include <boost/test/included/unit_test_framework.hpp>
+
+#include "mcrl2/data/detail/prover/bdd_path_eliminator.h"
+
+using namespace mcrl2;
+using namespace mcrl2::data;
+
+/// \brief An SMT solver for conjunctions of boolean variables and their negations, which
+///        counts the number of queries.
+class literal_solver: public detail::SMT_Solver
+{
+  public:
+    std::size_t& m_queries;
+
+    explicit literal_solver(std::size_t& queries)
+      : m_queries(queries)
+    {}
+
+    bool is_satisfiable(const data_expression_list& a_formula) override
+    {
+      ++m_queries;
+      for (const data_expression& x: a_formula)
+      {
+        if (std::find(a_formula.begin(), a_formula.end(), sort_bool::not_(x)) != a_formula.end())
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(test_path_elimination)
+{
+  const variable b("b", sort_bool::bool_());
+  const variable c("c", sort_bool::bool_());
+  const data_expression t = sort_bool::true_();
+  const data_expression f = sort_bool::false_();
+
+  // The innermost guard b is implied by the path leading to it. The guard b at the root
+  // becomes superfluous afterwards.
+  const data_expression bdd = if_(b, if_(c, if_(b, t, f), f), if_(c, t, f));
+
+  std::size_t queries = 0;
+  detail::BDD_Path_Eliminator eliminator(std::unique_ptr<detail::SMT_Solver>(new literal_solver(queries)));
+  BOOST_CHECK_EQUAL(eliminator.simplify(bdd), if_(c, t, f));
+
+  // Of the eight checked conditions only five are distinct.
+  BOOST_CHECK_EQUAL(queries, 5u);
+
+  // Simplifying the same BDD again only uses the answers of earlier queries.
+  BOOST_CHECK_EQUAL(eliminator.simplify(bdd), if_(c, t, f));
+  BOOST_CHECK_EQUAL(queries, 5u);
+}
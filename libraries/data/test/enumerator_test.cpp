@@ -491,3 +491,91 @@ BOOST_AUTO_TEST_CASE(enumerate_expressions_test)
   std::string expected_result = "[ d1(e1), d1(e2), d2(e1), d2(e2) ]";
   BOOST_CHECK(result == expected_result);
 }
+
+BOOST_AUTO_TEST_CASE(enumerate_with_queue_limit)
+{
+  typedef enumerator_list_element_with_substitution<> enumerator_element;
+  data_specification dataspec;
+  dataspec.add_context_sort(sort_nat::nat());
+  rewriter r(dataspec);
+  const variable_list v = parse_variable_list("n: Nat; m: Nat;", dataspec);
+  const data_expression phi = parse_data_expression("n < 30 && m < 20", v, dataspec);
+
+  auto enumerate = [&](std::size_t max_queue_size, std::size_t& max_size)
+  {
+    enumerator_identifier_generator id_generator;
+    enumerator_algorithm<> E(r, dataspec, r, id_generator, false);
+    E.set_max_queue_size(max_queue_size);
+    mutable_indexed_substitution<> sigma;
+    enumerator_queue<enumerator_element> P(enumerator_element(v, phi));
+    std::set<data_expression> solutions;
+    max_size = 0;
+    E.enumerate_all(P, sigma,
+                    [&](const enumerator_element& p)
+                    {
+                      max_size = std::max(max_size, P.size());
+                      data::mutable_indexed_substitution<> sigma1;
+                      p.add_assignments(v, sigma1, r);
+                      solutions.insert(r(sort_nat::plus(sigma1(v.front()), sort_nat::times(sort_nat::nat(100), sigma1(v.tail().front())))));
+                      return false;
+                    },
+                    is_false
+    );
+    return solutions;
+  };
+
+  std::size_t unbounded_size;
+  std::size_t bounded_size;
+  const std::set<data_expression> unbounded = enumerate(std::numeric_limits<std::size_t>::max(), unbounded_size);
+  const std::set<data_expression> bounded = enumerate(8, bounded_size);
+  BOOST_CHECK_EQUAL(unbounded.size(), 600u);
+  BOOST_CHECK(bounded == unbounded);
+  BOOST_CHECK(bounded_size < unbounded_size);
+}
+
+// Nested and interrupted enumerations reuse the queues of earlier enumerations.
+BOOST_AUTO_TEST_CASE(enumerate_with_recycled_queues)
+{
+  typedef enumerator_list_element<> enumerator_element;
+  data_specification dataspec;
+  dataspec.add_context_sort(sort_nat::nat());
+  rewriter r(dataspec);
+  enumerator_identifier_generator id_generator;
+  enumerator_algorithm<> E(r, dataspec, r, id_generator, false);
+  mutable_indexed_substitution<> sigma;
+  const variable_list n = parse_variable_list("n: Nat;", dataspec);
+  const variable_list m = parse_variable_list("m: Nat;", dataspec);
+
+  const std::size_t pool_size = detail::enumerator_queues<enumerator_element>().size();
+  std::size_t outer = 0;
+  std::size_t inner = 0;
+  E.enumerate(enumerator_element(n, parse_data_expression("n < 3", n, dataspec)),
+              sigma,
+              [&](const enumerator_element&)
+              {
+                outer++;
+                E.enumerate(enumerator_element(m, parse_data_expression("m < 4", m, dataspec)),
+                            sigma,
+                            [&](const enumerator_element&) { inner++; return false; },
+                            is_false);
+                return false;
+              },
+              is_false);
+  BOOST_CHECK_EQUAL(outer, 3u);
+  BOOST_CHECK_EQUAL(inner, 12u);
+  BOOST_CHECK_EQUAL(detail::enumerator_queues<enumerator_element>().size(), std::max<std::size_t>(pool_size, 2));
+
+  // An interrupted enumeration leaves no elements behind for the next one.
+  std::size_t count = 0;
+  E.enumerate(enumerator_element(n, parse_data_expression("n < 10", n, dataspec)),
+              sigma,
+              [&](const enumerator_element&) { return ++count == 2; },
+              is_false);
+  BOOST_CHECK_EQUAL(count, 2u);
+  count = 0;
+  E.enumerate(enumerator_element(m, parse_data_expression("m < 4", m, dataspec)),
+              sigma,
+              [&](const enumerator_element&) { count++; return false; },
+              is_false);
+  BOOST_CHECK_EQUAL(count, 4u);
+}
@@ -11,11 +11,15 @@
 
 #define BOOST_TEST_MODULE rewriter_test
 #include "mcrl2/data/detail/one_point_rule_preprocessor.h"
+#include "mcrl2/data/detail/rewrite/indexed_strategy.h"
 #include "mcrl2/data/detail/parse_substitution.h"
+#include "mcrl2/data/detail/rewrite_profile.h"
+#include "mcrl2/data/detail/rewrite_strategies.h"
 #include "mcrl2/data/detail/test_rewriters.h"
 #include "mcrl2/data/print.h"
 #include "mcrl2/data/rewriter.h"
 #include "mcrl2/data/rewriters/simplify_rewriter.h"
+#include "mcrl2/utilities/metrics.h"
 
 #include <boost/test/included/unit_test_framework.hpp>
 
@@ -256,3 +260,228 @@ BOOST_AUTO_TEST_CASE(test_main)
   test_equality_on_functions();
   test_enumeration_of_functions();
 }
+
+BOOST_AUTO_TEST_CASE(test_rewrite_profile)
+{
+  data_specification data_spec = parse_data_specification(
+    "map f: Nat -> Nat;\n"
+    "var n: Nat;\n"
+    "eqn f(0) = 1;\n"
+    "    n > 0 -> f(n) = n;\n"
+  );
+  const data_equation& eq1 = data_spec.user_defined_equations()[0];
+  const data_equation& eq2 = data_spec.user_defined_equations()[1];
+  const function_symbol f("f", make_function_sort(sort_nat::nat(), sort_nat::nat()));
+
+  data::detail::rewrite_profile profile;
+  BOOST_CHECK(profile.empty());
+  {
+    data::detail::rewrite_profile::symbol_timer timer(&profile, f);
+    profile.match_failed(eq1);
+    profile.applied(eq2);
+    profile.applied(eq2);
+    profile.condition_failed(eq2);
+  }
+  {
+    // A timer without a profile does nothing.
+    data::detail::rewrite_profile::symbol_timer timer(nullptr, f);
+  }
+
+  std::ostringstream out;
+  profile.report(out);
+  const std::string report = out.str();
+
+  // The equation that is applied most often comes first.
+  BOOST_CHECK(report.find(data::pp(eq2)) < report.find(data::pp(eq1)));
+  BOOST_CHECK(report.find("           2           0           1  " + data::pp(eq2)) != std::string::npos);
+  BOOST_CHECK(report.find("           0           1           0  " + data::pp(eq1)) != std::string::npos);
+
+  // The head symbol f has been rewritten once.
+  const std::size_t symbol_position = report.find("  f: Nat -> Nat");
+  BOOST_REQUIRE(symbol_position != std::string::npos);
+  BOOST_CHECK_EQUAL(report.substr(symbol_position - 24, 12), "           1");
+}
+
+BOOST_AUTO_TEST_CASE(test_normal_form_cache)
+{
+  data_specification data_spec = parse_data_specification(
+    "map f: Nat -> Nat;\n"
+    "var n: Nat;\n"
+    "eqn f(n) = n + 1;\n"
+  );
+  const variable n("n", sort_nat::nat());
+  const variable m("m", sort_nat::nat());
+  const data_expression closed_term = parse_data_expression("f(2)", data_spec);
+  const data_expression term_n = parse_data_expression("f(n)", variable_list({ n }), data_spec);
+  const data_expression term_m = parse_data_expression("f(m)", variable_list({ m }), data_spec);
+
+  for (const rewrite_strategy strategy: data::detail::get_test_rewrite_strategies(false))
+  {
+    data::detail::normal_form_cache_size() = 16;
+    std::shared_ptr<data::detail::Rewriter> R = data::detail::createRewriter(data_spec, used_data_equation_selector(data_spec), strategy);
+    data::detail::normal_form_cache_size() = 0;
+
+    // The normal forms of closed terms are cached, and do not depend on the substitution.
+    data::detail::Rewriter::substitution_type sigma;
+    BOOST_CHECK_EQUAL(R->rewrite(closed_term, sigma), sort_nat::nat(3));
+    sigma[n] = sort_nat::nat(5);
+    BOOST_CHECK_EQUAL(R->rewrite(closed_term, sigma), sort_nat::nat(3));
+    BOOST_CHECK_EQUAL(R->normal_form_cache_misses(), 1u);
+    BOOST_CHECK_EQUAL(R->normal_form_cache_hits(), 1u);
+
+    // A term whose variables are mapped to closed terms is cached as its instance.
+    BOOST_CHECK_EQUAL(R->rewrite(term_n, sigma), sort_nat::nat(6));
+    BOOST_CHECK_EQUAL(R->rewrite(term_n, sigma), sort_nat::nat(6));
+    sigma[n] = sort_nat::nat(2);
+    BOOST_CHECK_EQUAL(R->rewrite(term_n, sigma), sort_nat::nat(3));
+    sigma[n] = sort_nat::nat(7);
+    BOOST_CHECK_EQUAL(R->rewrite(term_n, sigma), sort_nat::nat(8));
+    BOOST_CHECK_EQUAL(R->normal_form_cache_misses(), 3u);
+    BOOST_CHECK_EQUAL(R->normal_form_cache_hits(), 3u);
+
+    // Open terms are neither looked up nor stored in the cache.
+    const data_expression result_m = R->rewrite(term_m, sigma);
+    BOOST_CHECK(result_m != term_m);
+    BOOST_CHECK_EQUAL(R->rewrite(term_m, sigma), result_m);
+    BOOST_CHECK_EQUAL(R->normal_form_cache_misses(), 3u);
+    BOOST_CHECK_EQUAL(R->normal_form_cache_hits(), 3u);
+
+    // Many different closed terms exceed the capacity of the cache.
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+      BOOST_CHECK_EQUAL(R->rewrite(sort_nat::plus(sort_nat::nat(i), sort_nat::nat(1)), sigma), sort_nat::nat(i + 1));
+    }
+    BOOST_CHECK_EQUAL(R->normal_form_cache_misses(), 103u);
+    BOOST_CHECK_EQUAL(R->rewrite(closed_term, sigma), sort_nat::nat(3));
+    BOOST_CHECK_EQUAL(R->normal_form_cache_misses(), 104u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_builtin_arithmetic)
+{
+  // A user defined mapping with the name of a system defined one is not evaluated as the latter.
+  const function_symbol user_abs("abs", make_function_sort(sort_nat::nat(), sort_nat::nat()));
+  const variable n("n", sort_nat::nat());
+  data_specification data_spec;
+  data_spec.add_context_sort(sort_int::int_());
+  data_spec.add_mapping(user_abs);
+  data_spec.add_equation(data_equation(variable_list({ n }), user_abs(n), sort_nat::c0()));
+
+  data::rewriter::substitution_type sigma;
+  sigma[n] = sort_nat::nat(4);
+
+  // The expressions, their normal forms and whether machine integers can be used.
+  const std::vector<std::tuple<std::string, std::string, bool>> cases = {
+    { "2 + 3", "5", true },
+    { "n * n - 10", "6", true },
+    { "7 div 2", "3", true },
+    { "-7 div 2", "-4", true },
+    { "-7 mod 2", "1", true },
+    { "pred(1)", "0", true },
+    { "abs(-5)", "5", true },
+    { "max(3, -4)", "3", true },
+    { "-3 >= 2", "false", true },
+    { "n == 4", "true", true },
+    // The results below do not fit in the machine integers that are used.
+    { "exp(2, 62) + exp(2, 62)", "9223372036854775808", false },
+    { "exp(2, 70)", "1180591620717411303424", false }
+  };
+
+  // The code that the compiling rewriter generates for these mappings is always tested.
+  std::vector<rewrite_strategy> strategies = data::detail::get_test_rewrite_strategies(false);
+#if defined(MCRL2_JITTYC_AVAILABLE) && !defined(MCRL2_TEST_JITTYC)
+  strategies.push_back(jitty_compiling);
+#endif
+
+  // The evaluations are counted in the metrics, which must be enabled before a rewriter is created.
+  utilities::metrics().enable();
+  const utilities::metric_counter& evaluations = utilities::metrics().counter("rewriter.builtin_arithmetic_evaluations");
+  for (const rewrite_strategy strategy: strategies)
+  {
+    data::rewriter R(data_spec, strategy);
+    for (const auto& [expression, expected, builtin]: cases)
+    {
+      const data_expression x = parse_data_expression(expression, variable_list({ n }), data_spec);
+      const std::size_t count = evaluations.value();
+      BOOST_CHECK_EQUAL(data::pp(R(x, sigma)), expected);
+      if (builtin)
+      {
+        BOOST_CHECK_MESSAGE(evaluations.value() > count, expression << " is not evaluated using machine integers");
+      }
+    }
+
+    const std::size_t count = evaluations.value();
+    BOOST_CHECK_EQUAL(R(user_abs(sort_nat::nat(3))), sort_nat::c0());
+    BOOST_CHECK_EQUAL(evaluations.value(), count);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_indexed_strategy)
+{
+  // The rules do not overlap, such that the result does not depend on the order in which they are tried.
+  data_specification data_spec = parse_data_specification(
+    "sort Colour = struct red | green | blue | yellow | black;\n"
+    "map f: Colour # Nat -> Nat;\n"
+    "var n: Nat;\n"
+    "eqn f(red, n) = 1;\n"
+    "    f(green, n) = 3;\n"
+    "    f(blue, n) = n + 5;\n"
+    "    f(yellow, n) = n;\n"
+  );
+
+  const function_symbol f("f", function_sort({ sort_expression(basic_sort("Colour")), sort_nat::nat() }, sort_nat::nat()));
+  data_equation_list rules;
+  for (const data_equation& eq: data_spec.equations())
+  {
+    if (data::detail::get_nested_head(eq.lhs()) == f)
+    {
+      rules.push_front(eq);
+    }
+  }
+  BOOST_CHECK_EQUAL(rules.size(), 4u);
+
+  // In each step that is indexed on the first argument, a colour only selects the rules for that colour.
+  const data_expression blue = parse_data_expression("blue", data_spec);
+  const data_expression black = parse_data_expression("black", data_spec);
+  const data::detail::indexed_strategy strat(data::detail::create_strategy(rules));
+  std::size_t indexed_steps = 0;
+  std::size_t blue_rules = 0;
+  std::size_t black_rules = 0;
+  for (const data::detail::indexed_strategy::step& step: strat.steps())
+  {
+    if (step.is_indexed())
+    {
+      indexed_steps++;
+      BOOST_CHECK_EQUAL(step.indexed_argument(), 0u);
+      const data_expression blue_arguments[] = { blue, sort_nat::nat(0) };
+      const data::detail::indexed_strategy::rule_range blue_range = step.candidates(blue_arguments);
+      for (const data_equation* rule = blue_range.first; rule != blue_range.second; ++rule)
+      {
+        BOOST_CHECK_EQUAL(atermpp::down_cast<application>(rule->lhs())[0], blue);
+        blue_rules++;
+      }
+      const data_expression black_arguments[] = { black, sort_nat::nat(0) };
+      const data::detail::indexed_strategy::rule_range black_range = step.candidates(black_arguments);
+      black_rules += black_range.second - black_range.first;
+    }
+  }
+  BOOST_CHECK(indexed_steps > 0);
+  BOOST_CHECK_EQUAL(blue_rules, 1u);
+  BOOST_CHECK_EQUAL(black_rules, 0u);
+
+  const std::vector<std::pair<std::string, std::string>> cases = {
+    { "f(red, 7)", "1" },
+    { "f(black, 3)", "f(black, 3)" },
+    { "f(green, 3)", "3" },
+    { "f(blue, 3)", "8" },
+    { "f(yellow, 3)", "3" }
+  };
+  for (const rewrite_strategy strategy: data::detail::get_test_rewrite_strategies(false))
+  {
+    data::rewriter R(data_spec, strategy);
+    for (const auto& [expression, expected]: cases)
+    {
+      BOOST_CHECK_EQUAL(data::pp(R(parse_data_expression(expression, data_spec))), expected);
+    }
+  }
+}
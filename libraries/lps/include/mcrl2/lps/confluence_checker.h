@@ -15,9 +15,14 @@
 #ifndef MCRL2_LPS_CONFLUENCE_CHECKER_H
 #define MCRL2_LPS_CONFLUENCE_CHECKER_H
 
+#include "mcrl2/atermpp/aterm_io_binary.h"
+#include "mcrl2/data/data_io.h"
+#include "mcrl2/data/detail/io.h"
 #include "mcrl2/lps/disjointness_checker.h"
 #include "mcrl2/lps/invariant_checker.h"
+#include <fstream>
 #include <iomanip>
+#include <unordered_map>
 
 
 /** \brief A class that takes a linear process specification and checks all tau-summands of that LPS for confluence.
@@ -82,6 +87,14 @@
     confluence condition is indeed an invariant, the two summands are proven confluent. The class Confluence_Checker
     indicates this by printing an 'i'.
 
+         The answers of the prover are kept in a cache, indexed by the confluence condition in which all variables
+    are renamed in order of their occurrence. Summands that only differ in the names of their variables, which are
+    frequently generated by the linearisation, therefore lead to a single proof. If the parameter
+    a_proof_cache_file_name is not empty, the conditions that were proven to be tautologies are read from, and
+    afterwards written to, the file with that name. Rerunning the checker after a small change of the LPS then only
+    proves the conditions of the summands that have changed. The file is ignored when it was written for a different
+    data specification.
+
     The class Confluence_Checker uses an instance of the class BDD_Prover, an instance of the class Disjointness_Checker
     and an instance of the class Invariant_Checker to determine which tau-summands of an mCRL2 LPS are confluent.
     Confluent tau-summands will be marked by renaming their tau-actions to ctau. The constructor
@@ -209,12 +222,39 @@ class Confluence_Checker
     /// \brief Identifier generator to allow variables to be uniquely renamed.
     data::set_identifier_generator f_set_identifier_generator;
 
+    /// \brief The answers of the prover, indexed by the normalised confluence conditions.
+    std::unordered_map<data::data_expression, data::detail::Answer> f_proof_cache;
+
+    /// \brief The number of confluence conditions whose answer was taken from the proof cache.
+    std::size_t f_proof_cache_hits = 0;
+
+    /// \brief Flag indicating whether answers other than answer_yes are cached, which is not the case when a
+    /// \brief time limit can cause the prover to give up.
+    bool f_cache_failed_proofs;
+
+    /// \brief The name of the file in which proven confluence conditions are stored between runs. If the string is
+    /// \brief empty, no file is used.
+    std::string f_proof_cache_file_name;
+
     /// \brief Writes a dot file of the BDD created when checking the confluence of summands a_summand_number_1 and a_summand_number_2.
     void save_dot_file(std::size_t a_summand_number_1, std::size_t a_summand_number_2);
 
     /// \brief Outputs a path in the BDD corresponding to the condition at hand that leads to a node labelled false.
     void print_counter_example();
 
+    /// \brief Returns the condition in which all variables are renamed in the order in which they occur.
+    data::data_expression normalise_condition(const data::data_expression& a_condition) const;
+
+    /// \brief Determines whether a_condition is a tautology, using the proof cache when possible. The BDD of the
+    /// \brief prover only corresponds to a_condition when the answer is not answer_yes.
+    data::detail::Answer prove_condition(const data::data_expression& a_condition);
+
+    /// \brief Reads the proven conditions from the file Confluence_Checker::f_proof_cache_file_name.
+    void load_proof_cache();
+
+    /// \brief Writes the proven conditions to the file Confluence_Checker::f_proof_cache_file_name.
+    void save_proof_cache() const;
+
     /// \brief Checks the confluence of summand a_summand_1 and a_summand_2
     bool check_summands(
       const data::data_expression& a_invariant,
@@ -255,7 +295,8 @@ class Confluence_Checker
       std::string a_conditions = "c",
       bool a_counter_example = false,
       bool a_generate_invariants = false,
-      std::string const& a_dot_file_name = std::string()
+      std::string const& a_dot_file_name = std::string(),
+      std::string const& a_proof_cache_file_name = std::string()
     );
 
     /// \brief Check the confluence of the LPS Confluence_Checker::f_lps.
@@ -662,6 +703,123 @@ void Confluence_Checker<Specification>::uniquely_rename_summutation_variables(
 
 // --------------------------------------------------------------------------------------------
 
+template <typename Specification>
+data::data_expression Confluence_Checker<Specification>::normalise_condition(const data::data_expression& a_condition) const
+{
+  std::vector<data::variable> v_variables;
+  data::find_all_variables(a_condition, std::back_inserter(v_variables));
+
+  std::set<data::variable> v_seen;
+  data::mutable_map_substitution<std::map<data::variable, data::variable> > v_renaming;
+  for (const data::variable& v: v_variables)
+  {
+    if (v_seen.insert(v).second)
+    {
+      v_renaming[v] = data::variable("v" + std::to_string(v_seen.size() - 1), v.sort());
+    }
+  }
+
+  return data::replace_all_variables(a_condition, v_renaming);
+}
+
+// --------------------------------------------------------------------------------------------
+
+template <typename Specification>
+data::detail::Answer Confluence_Checker<Specification>::prove_condition(const data::data_expression& a_condition)
+{
+  const data::data_expression v_key = normalise_condition(a_condition);
+  auto i = f_proof_cache.find(v_key);
+
+  // The BDD of a failed proof is needed to generate invariants, counter examples and dot files.
+  const bool v_bdd_needed = f_generate_invariants || f_counter_example || !f_dot_file_name.empty();
+  if (i != f_proof_cache.end() && (i->second == data::detail::answer_yes || !v_bdd_needed))
+  {
+    f_proof_cache_hits++;
+    return i->second;
+  }
+
+  f_bdd_prover.set_formula(a_condition);
+  const data::detail::Answer v_answer = f_bdd_prover.is_tautology();
+  if (v_answer == data::detail::answer_yes || f_cache_failed_proofs)
+  {
+    f_proof_cache[v_key] = v_answer;
+  }
+  return v_answer;
+}
+
+// --------------------------------------------------------------------------------------------
+
+static inline
+atermpp::aterm_appl confluence_proof_cache_marker()
+{
+  return atermpp::aterm_appl(atermpp::function_symbol("confluence_proof_cache", 0));
+}
+
+template <typename Specification>
+void Confluence_Checker<Specification>::load_proof_cache()
+{
+  std::ifstream v_stream(f_proof_cache_file_name, std::ios_base::binary);
+  if (!v_stream.good())
+  {
+    mCRL2log(log::verbose) << "Proof cache " << f_proof_cache_file_name << " does not exist yet." << std::endl;
+    return;
+  }
+
+  atermpp::binary_aterm_istream v_input(v_stream);
+  v_input >> data::detail::add_index_impl;
+
+  atermpp::aterm v_marker;
+  v_input >> v_marker;
+  if (v_marker != confluence_proof_cache_marker())
+  {
+    throw mcrl2::runtime_error("File " + f_proof_cache_file_name + " does not contain a confluence proof cache.");
+  }
+
+  data::data_specification v_data;
+  v_input >> v_data;
+  if (data::detail::data_specification_to_aterm(v_data) != data::detail::data_specification_to_aterm(f_lps.data()))
+  {
+    mCRL2log(log::warning) << "Ignoring proof cache " << f_proof_cache_file_name << " as it belongs to a different data specification." << std::endl;
+    return;
+  }
+
+  std::vector<data::data_expression> v_conditions;
+  v_input >> v_conditions;
+  for (const data::data_expression& v_condition: v_conditions)
+  {
+    f_proof_cache[v_condition] = data::detail::answer_yes;
+  }
+  mCRL2log(log::verbose) << "Read " << v_conditions.size() << " proven conditions from " << f_proof_cache_file_name << "." << std::endl;
+}
+
+template <typename Specification>
+void Confluence_Checker<Specification>::save_proof_cache() const
+{
+  // Only tautologies are stored, as the other answers depend on the options of the prover.
+  std::vector<data::data_expression> v_conditions;
+  for (const auto& entry: f_proof_cache)
+  {
+    if (entry.second == data::detail::answer_yes)
+    {
+      v_conditions.push_back(entry.first);
+    }
+  }
+
+  std::ofstream v_stream(f_proof_cache_file_name, std::ios_base::binary);
+  if (!v_stream.good())
+  {
+    throw mcrl2::runtime_error("Could not open file " + f_proof_cache_file_name + ".");
+  }
+
+  atermpp::binary_aterm_ostream v_output(v_stream);
+  v_output << data::detail::remove_index_impl;
+  v_output << confluence_proof_cache_marker();
+  v_output << f_lps.data();
+  v_output << v_conditions;
+}
+
+// --------------------------------------------------------------------------------------------
+
 template <typename Specification>
 bool Confluence_Checker<Specification>::check_summands(
   const data::data_expression& a_invariant,
@@ -690,8 +848,7 @@ bool Confluence_Checker<Specification>::check_summands(
     }
 
     const data::data_expression v_condition = get_confluence_condition(a_invariant, a_summand_1, tagged, v_variables, a_condition_type);
-    f_bdd_prover.set_formula(v_condition);
-    if (f_bdd_prover.is_tautology() == data::detail::answer_yes)
+    if (prove_condition(v_condition) == data::detail::answer_yes)
     {
       mCRL2log(log::info) << "+";
     }
@@ -842,7 +999,8 @@ Confluence_Checker<Specification>::Confluence_Checker(
   std::string a_conditions,
   bool a_counter_example,
   bool a_generate_invariants,
-  std::string const& a_dot_file_name):
+  std::string const& a_dot_file_name,
+  std::string const& a_proof_cache_file_name):
   f_disjointness_checker(a_lps.process()),
   f_invariant_checker(a_lps, a_rewrite_strategy, a_time_limit, a_path_eliminator, a_solver_type, false, false, 0),
   f_bdd_prover(a_lps.data(), data::used_data_equation_selector(a_lps.data()), a_rewrite_strategy,
@@ -853,7 +1011,9 @@ Confluence_Checker<Specification>::Confluence_Checker(
   f_conditions(a_conditions),
   f_counter_example(a_counter_example),
   f_dot_file_name(a_dot_file_name),
-  f_generate_invariants(a_generate_invariants)
+  f_generate_invariants(a_generate_invariants),
+  f_cache_failed_proofs(a_time_limit == 0),
+  f_proof_cache_file_name(a_proof_cache_file_name)
 {
   if (has_ctau_action(a_lps))
   {
@@ -911,6 +1071,11 @@ void Confluence_Checker<Specification>::check_confluence_and_mark(const data::da
   f_number_of_summands = v_summands.size();
   std::string v_conditions = std::string(f_conditions);
 
+  if (!f_proof_cache_file_name.empty())
+  {
+    load_proof_cache();
+  }
+
   while (v_conditions.length() > 0)
   {
     f_intermediate = std::vector<std::size_t>(f_number_of_summands + 2, 0);
@@ -948,6 +1113,12 @@ void Confluence_Checker<Specification>::check_confluence_and_mark(const data::da
 
   mCRL2log(log::info) << v_marked_summands.size() << " of " << (v_marked_summands.size() + v_unmarked_summands.size()) <<
                          " tau summands were found to be confluent" << std::endl;
+  mCRL2log(log::verbose) << f_proof_cache_hits << " confluence conditions were found in the proof cache" << std::endl;
+
+  if (!f_proof_cache_file_name.empty())
+  {
+    save_proof_cache();
+  }
 
   f_intermediate = std::vector<std::size_t>();
 }
@@ -164,11 +164,51 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
       // undo contains undo information of instantiations of free variables
       std::map<data::variable, std::set<data::variable> > undo;
 
+      // A summand only needs to be examined again if the value in sigma of one of the variables in
+      // its condition or next state has changed since it was examined. To detect this, every change
+      // of sigma gets a time stamp.
+      std::size_t time = 0;
+      std::map<data::variable, std::size_t> last_change;
+      auto assign = [&](const data::variable& v, const data::data_expression& x)
+      {
+        sigma[v] = x;
+        last_change[v] = ++time;
+      };
+
+      const auto& summands = process.action_summands();
+      std::vector<std::set<data::variable> > summand_variables;
+      for (const auto& summand: summands)
+      {
+        std::set<data::variable> V = data::find_free_variables(summand.condition());
+        data::find_free_variables(summand.assignments(), std::inserter(V, V.end()));
+        summand_variables.push_back(V);
+      }
+      std::vector<std::size_t> examined(summands.size(), 0);
+      auto is_unaffected = [&](std::size_t i)
+      {
+        for (const data::variable& v: summand_variables[i])
+        {
+          auto j = last_change.find(v);
+          if (j != last_change.end() && j->second > examined[i])
+          {
+            return false;
+          }
+        }
+        return true;
+      };
+
       do
       {
         dG.clear();
-        for (const auto& summand: process.action_summands())
+        for (std::size_t i = 0; i < summands.size(); ++i)
         {
+          if (examined[i] > 0 && is_unaffected(i))
+          {
+            continue;
+          }
+          examined[i] = ++time;
+
+          const auto& summand = summands[i];
           const data::data_expression& c_i = summand.condition();
           if (m_ignore_conditions || (R(c_i, sigma) != data::sort_bool::false_()))
           {
@@ -181,30 +221,31 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
               std::size_t index_j = m_index_of[j];
               const data::variable& d_j = j;
               data::data_expression g_ij = super::next_state(summand, d_j);
+              data::data_expression Rg_ij = R(g_ij, sigma);
+              data::data_expression Rd_j = R(d_j, sigma);
 
-              if (R(g_ij, sigma) != R(d_j, sigma))
+              if (Rg_ij != Rd_j)
               {
-                LOG_PARAMETER_CHANGE(d_j, R(d_j, sigma), R(g_ij, sigma), sigma, "POSSIBLE CHANGE FOR PARAMETER ");
-                data::data_expression z = R(g_ij, sigma);
-                if (is_variable(z) && contains(global_variables, atermpp::down_cast<data::variable>(z)))
+                LOG_PARAMETER_CHANGE(d_j, Rd_j, Rg_ij, sigma, "POSSIBLE CHANGE FOR PARAMETER ");
+                if (is_variable(Rg_ij) && contains(global_variables, atermpp::down_cast<data::variable>(Rg_ij)))
                 {
-                  sigma[atermpp::down_cast<data::variable>(z)] = r[index_j];
-                  undo[d_j].insert(atermpp::down_cast<data::variable>(z));
+                  assign(atermpp::down_cast<data::variable>(Rg_ij), r[index_j]);
+                  undo[d_j].insert(atermpp::down_cast<data::variable>(Rg_ij));
                 }
                 else
                 {
                   dG.insert(d_j);
-                  sigma[d_j] = d_j; // erase d_j
+                  assign(d_j, d_j); // erase d_j
                   for (const data::variable& w: undo[d_j])
                   {
-                    sigma[w] = w; // erase *w
+                    assign(w, w); // erase *w
                   }
                   undo[d_j].clear();
                 }
               }
               else
               {
-                LOG_PARAMETER_CHANGE(d_j, R(d_j, sigma), R(g_ij, sigma), sigma, "NO CHANGE FOR PARAMETER ");
+                LOG_PARAMETER_CHANGE(d_j, Rd_j, Rg_ij, sigma, "NO CHANGE FOR PARAMETER ");
               }
             }
           }
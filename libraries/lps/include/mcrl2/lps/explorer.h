@@ -12,8 +12,12 @@
 #ifndef MCRL2_LPS_EXPLORER_H
 #define MCRL2_LPS_EXPLORER_H
 
+#include <chrono>
+#include <iomanip>
 #include <random>
+#include <sstream>
 #include "mcrl2/data/consistency.h"
+#include "mcrl2/data/detail/rewrite_profile.h"
 #include "mcrl2/data/enumerator.h"
 #include "mcrl2/data/substitution_utility.h"
 #include "mcrl2/lps/detail/instantiate_global_variables.h"
@@ -25,6 +29,7 @@
 #include "mcrl2/lps/resolve_name_clashes.h"
 #include "mcrl2/lps/stochastic_state.h"
 #include "mcrl2/utilities/detail/io.h"
+#include "mcrl2/utilities/metrics.h"
 #include "mcrl2/utilities/skip.h"
 
 namespace mcrl2::lps {
@@ -318,6 +323,14 @@ std::ostream& operator<<(std::ostream& out, const explorer_summand& summand)
   );
 }
 
+// The time spent in generating the outgoing transitions of a summand, and their number.
+// It is only collected with the option --profile-rewriting.
+struct explorer_summand_profile
+{
+  std::size_t transitions = 0;
+  std::chrono::steady_clock::duration time = std::chrono::steady_clock::duration::zero();
+};
+
 struct abortable
 {
   virtual void abort() = 0;
@@ -357,6 +370,7 @@ class explorer: public abortable
     bool m_recursive = false;
     std::vector<explorer_summand> m_regular_summands;
     std::vector<explorer_summand> m_confluent_summands;
+    std::vector<explorer_summand_profile> m_summand_profile; // Indexed by summand.index, or empty if profiling is disabled.
 
     volatile bool m_must_abort = false;
 
@@ -722,9 +736,46 @@ class explorer: public abortable
           m_regular_summands.emplace_back(summand, i, lpsspec_.process().process_parameters(), cache_strategy);
         }
       }
+
+      if (data::detail::rewrite_profiling_enabled())
+      {
+        m_summand_profile.resize(lpsspec_summands.size());
+      }
+    }
+
+    ~explorer()
+    {
+      if (!m_summand_profile.empty())
+      {
+        std::ostringstream out;
+        report_summand_profile(out);
+        mCRL2log(log::info) << out.str();
+      }
     }
 
-    ~explorer() = default;
+    /// \brief Prints the summands sorted by the time spent in generating their outgoing transitions.
+    void report_summand_profile(std::ostream& out) const
+    {
+      std::vector<const explorer_summand*> summands;
+      for (const explorer_summand& summand: m_regular_summands)
+      {
+        summands.push_back(&summand);
+      }
+      std::sort(summands.begin(), summands.end(), [&](const explorer_summand* x, const explorer_summand* y)
+        {
+          return m_summand_profile[x->index].time > m_summand_profile[y->index].time;
+        });
+
+      out << "Summands, sorted by the time spent in generating their transitions:\n"
+          << std::setw(12) << "summand" << std::setw(12) << "transitions" << std::setw(12) << "seconds" << "  actions\n";
+      for (const explorer_summand* summand: summands)
+      {
+        const explorer_summand_profile& profile = m_summand_profile[summand->index];
+        out << std::setw(12) << summand->index << std::setw(12) << profile.transitions
+            << std::setw(12) << std::fixed << std::setprecision(6) << data::detail::to_seconds(profile.time)
+            << "  " << (summand->multi_action.actions().empty() ? std::string("tau") : process::pp(summand->multi_action.actions())) << "\n";
+      }
+    }
 
     // Returns the concatenation of s and [t]
     state make_timed_state(const state& s, const data::data_expression& t) const
@@ -776,6 +827,10 @@ class explorer: public abortable
     {
       utilities::mcrl2_unused(discover_initial_state); // silence unused parameter warning
 
+      utilities::metrics_phase phase("explorer.exploration");
+      utilities::metric_histogram* outgoing_transitions_metric = utilities::metrics().enabled() ? &utilities::metrics().histogram("explorer.outgoing_transitions") : nullptr;
+      std::size_t transition_count = 0;
+
       m_recursive = recursive;
       std::unique_ptr<todo_set> todo;
       discovered.clear();
@@ -812,9 +867,12 @@ class explorer: public abortable
         state s = todo->choose_element();
         std::size_t s_index = discovered.index(s);
         start_state(s, s_index);
+        const std::size_t transition_count_before = transition_count;
         data::add_assignments(m_sigma, m_process_parameters, s);
         for (const explorer_summand& summand: regular_summands)
         {
+          const std::size_t summand_transition_count_before = transition_count;
+          const auto summand_start = m_summand_profile.empty() ? std::chrono::steady_clock::time_point() : std::chrono::steady_clock::now();
           generate_transitions(
             summand,
             confluent_summands,
@@ -845,6 +903,7 @@ class explorer: public abortable
                   s1_index.push_back(k);
                 }
                 examine_transition(s, s_index, a, s1, s1_index, summand.index);
+                transition_count++;
               }
               else
               {
@@ -868,14 +927,31 @@ class explorer: public abortable
                   }
                 }
                 examine_transition(s, s_index, a, s1, s1_index, summand.index);
+                transition_count++;
               }
             }
           );
+          if (!m_summand_profile.empty())
+          {
+            explorer_summand_profile& profile = m_summand_profile[summand.index];
+            profile.time += std::chrono::steady_clock::now() - summand_start;
+            profile.transitions += transition_count - summand_transition_count_before;
+          }
+        }
+        if (outgoing_transitions_metric != nullptr)
+        {
+          outgoing_transitions_metric->record(transition_count - transition_count_before);
         }
         finish_state(s, s_index, todo->size());
         todo->finish_state();
       }
       m_must_abort = false;
+
+      if (utilities::metrics().enabled())
+      {
+        utilities::metrics().set_gauge("explorer.states", discovered.size());
+        utilities::metrics().set_gauge("explorer.transitions", transition_count);
+      }
     }
 
     /// \brief Generates the state space, and reports all discovered states and transitions by means of callback
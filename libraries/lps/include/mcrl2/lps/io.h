@@ -13,8 +13,10 @@
 #define MCRL2_LPS_IO_H
 
 #include "mcrl2/atermpp/aterm_io_binary.h"
+#include "mcrl2/data/detail/rewrite/jitty_strategy_store.h"
 #include "mcrl2/lps/specification.h"
 #include "mcrl2/lps/stochastic_specification.h"
+#include "mcrl2/utilities/mapped_file.h"
 
 #include <fstream>
 
@@ -42,7 +44,9 @@ template <typename Specification>
 void save_lps(const Specification& spec, std::ostream& stream, const std::string& target = "")
 {
   mCRL2log(log::verbose) << "Saving LPS" << (target.empty()?"":" to " + target) << ".\n";
-  atermpp::binary_aterm_ostream(stream) << spec;
+  atermpp::binary_aterm_ostream output(stream);
+  output << spec;
+  data::detail::write_rewriter_state(output);
 }
 
 /// \brief Load LPS from file.
@@ -54,7 +58,9 @@ template <typename Specification>
 void load_lps(Specification& spec, std::istream& stream, const std::string& source = "")
 {
   mCRL2log(log::verbose) << "Loading LPS" << (source.empty()?"":" from " + source) << ".\n";
-  atermpp::binary_aterm_istream(stream) >> spec;
+  atermpp::binary_aterm_istream input(stream);
+  input >> spec;
+  data::detail::read_rewriter_state(input);
 }
 
 /// \brief Saves an LPS to a file.
@@ -90,11 +96,7 @@ void load_lps(Specification& spec, const std::string& filename)
     return;
   }
 
-  std::ifstream ifs(filename, std::ios_base::binary);
-  if (!ifs.good())
-  {
-    throw mcrl2::runtime_error("Could not open file " + filename + ".");
-  }
+  utilities::mapped_file_istream ifs(filename);
   load_lps(spec, ifs, filename);
 }
 
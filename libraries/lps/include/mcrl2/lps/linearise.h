@@ -71,6 +71,21 @@ mcrl2::lps::stochastic_specification linearise(
   const mcrl2::process::process_specification& type_checked_spec,
   mcrl2::lps::t_lin_options lin_options = t_lin_options());
 
+/// \brief Linearises a process specification, reusing an earlier result that is stored in a file
+/// \details If the file cache_filename contains the linearisation of type_checked_spec with the
+///          same options, that linearisation is returned. Otherwise the specification is linearised
+///          and the result is stored in cache_filename, together with the specification and the
+///          options, replacing the earlier contents.
+/// \param[in] type_checked_spec A process specification
+/// \param[in] lin_options options that should be used during linearisation
+/// \param[in] cache_filename The name of the file that caches the result
+/// \return An LPS equivalent to spec, which is linearised using lin_options
+/// \exception mcrl2::runtime_error Linearisation failed, or the cache could not be written
+mcrl2::lps::stochastic_specification linearise(
+  const mcrl2::process::process_specification& type_checked_spec,
+  const mcrl2::lps::t_lin_options& lin_options,
+  const std::string& cache_filename);
+
 /// \brief Linearises a process specification from a textual specification
 /// \param[in] text A string containing a process specification
 /// \param[in] lin_options options that should be used during linearisation
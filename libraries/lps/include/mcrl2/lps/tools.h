@@ -54,6 +54,13 @@ bool lpsinvelm(const std::string& input_filename,
                const int time_limit
               );
 
+/// \brief Applies rewriting, sum elimination, constant elimination and parameter elimination
+/// to the LPS in input_filename until it no longer shrinks, using a single rewriter.
+void lpsoptimise(const std::string& input_filename,
+                 const std::string& output_filename,
+                 data::rewriter::strategy rewrite_strategy
+                );
+
 void lpsparelm(const std::string& input_filename,
                const std::string& output_filename
               );
@@ -32,6 +32,7 @@
 
 // linear process libraries.
 #include "mcrl2/lps/detail/ultimate_delay.h"
+#include "mcrl2/lps/io.h"
 #include "mcrl2/lps/linearise.h"
 #include "mcrl2/lps/sumelm.h"
 #include "mcrl2/lps/constelm.h"
@@ -41,6 +42,9 @@
 #include "mcrl2/process/alphabet_reduce.h"
 #include "mcrl2/process/balance_nesting_depth.h"
 
+#include <fstream>
+#include <unordered_set>
+
 
 // For Aterm library extension functions
 using namespace atermpp;
@@ -195,6 +199,11 @@ class specification_basic_type
     set_identifier_generator fresh_identifier_generator;
     std::vector < enumeratedtype > enumeratedtypes;
     stackoperations* stack_operations_list;
+    // The allow and block lists for which allowed_labels and blocked_labels have been computed.
+    action_name_multiset_list allowed_labels_source;
+    std::unordered_set<identifier_string_list> allowed_labels;
+    action_name_multiset_list blocked_labels_source;
+    std::unordered_set<identifier_string> blocked_labels;
 
   public:
     specification_basic_type(const process::action_label_list& as,
@@ -7479,35 +7488,18 @@ class specification_basic_type
       return action_name_multiset_list(l.begin(),l.end(),[](const action_name_multiset& al){ return sort_action_labels(al); });
     }
 
-    /// \brief determine whether the multiaction has the same labels as the allow action,
-    //         in which case true is delivered. If multiaction is the action Terminate,
-    //         then true is also returned.
-
-    bool allowsingleaction(const action_name_multiset& allowaction,
-                           const action_list& multiaction)
+    /// \brief Determine whether the multiaction is the action Terminate.
+    bool is_termination_action(const action_list& multiaction) const
     {
-      /* The special cases where multiaction==tau and multiaction=={ Terminated } must have been
-         dealt with separately. */
-      assert(multiaction.size()!=0 && multiaction != action_list({ terminationAction }));
-
-      const identifier_string_list& names=allowaction.names();
-      identifier_string_list::const_iterator i=names.begin();
-
-      for (action_list::const_iterator walker=multiaction.begin();
-           walker!=multiaction.end(); ++walker,++i)
-      {
-        if (i==names.end())
-        {
-          return false;
-        }
-        if (*i!=walker->label().name())
-        {
-          return false;
-        }
-      }
-      return i==names.end();
+      return multiaction.size()==1 && multiaction.front()==terminationAction;
     }
 
+    /// \brief Determine whether the labels of the multiaction occur in the allow list. The empty
+    ///        multiaction and the action Terminate are always allowed.
+    /// \details The allow list is the same for all multiactions that are checked during the
+    ///          composition of two processes, of which there can be very many. The lists of labels
+    ///          in the allow list are therefore kept in a hash set, such that no linear scan over
+    ///          the allow list is needed for each multiaction.
     bool allow_(const action_name_multiset_list& allowlist,
                 const action_list& multiaction)
     {
@@ -7518,34 +7510,42 @@ class specification_basic_type
       }
 
       /* The multiaction is equal to the special Terminate action. This action cannot be blocked. */
-      if (multiaction == action_list({ terminationAction }))
+      if (is_termination_action(multiaction))
       {
         return true;
       }
 
-      for (action_name_multiset_list::const_iterator i=allowlist.begin();
-           i!=allowlist.end(); ++i)
+      if (allowlist!=allowed_labels_source)
       {
-        if (allowsingleaction(*i,multiaction))
+        allowed_labels.clear();
+        for (const action_name_multiset& a: allowlist)
         {
-          return true;
+          allowed_labels.insert(a.names());
         }
+        allowed_labels_source=allowlist;
       }
-      return false;
+
+      const identifier_string_list labels(multiaction.begin(), multiaction.end(),
+                                          [](const action& a){ return a.label().name(); });
+      return allowed_labels.count(labels)>0;
     }
 
+    /// \brief Determine whether one of the labels of the multiaction is blocked by the encap list.
     bool encap(const action_name_multiset_list& encaplist, const action_list& multiaction)
     {
+      assert(encaplist.size()==1);
+      if (encaplist!=blocked_labels_source)
+      {
+        const identifier_string_list& names=encaplist.front().names();
+        blocked_labels=std::unordered_set<identifier_string>(names.begin(),names.end());
+        blocked_labels_source=encaplist;
+      }
+
       for (const action& a: multiaction)
       {
-        assert(encaplist.size()==1);
-        for (const identifier_string& s1: encaplist.front().names())
+        if (blocked_labels.count(a.label().name())>0)
         {
-          const identifier_string s2=a.label().name();
-          if (s1==s2)
-          {
-            return true;
-          }
+          return true;
         }
       }
       return false;
@@ -8927,18 +8927,29 @@ class specification_basic_type
           const bool is_block,
           stochastic_action_summand_vector& action_summands)
     {
+      // Whether the summands of the second process are termination actions is determined once,
+      // instead of for every combination of summands.
+      std::vector<bool> terminates2;
+      terminates2.reserve(action_summands2.size());
+      for (const stochastic_action_summand& summand2: action_summands2)
+      {
+        terminates2.push_back(is_termination_action(summand2.multi_action().actions()));
+      }
+
       // First combine the action summands.
       for (const stochastic_action_summand& summand1: action_summands1)
       {
         const variable_list& sumvars1=summand1.summation_variables();
         const action_list multiaction1=summand1.multi_action().actions();
+        const bool terminates1=is_termination_action(multiaction1);
         const data_expression actiontime1=summand1.multi_action().time();
         const data_expression& condition1=summand1.condition();
         const assignment_list& nextstate1=summand1.assignments();
         const stochastic_distribution& distribution1=summand1.distribution();
 
-        for (const stochastic_action_summand& summand2: action_summands2)
+        for (std::size_t j=0; j<action_summands2.size(); ++j)
         {
+          const stochastic_action_summand& summand2=action_summands2[j];
           const variable_list& sumvars2=summand2.summation_variables();
           const action_list multiaction2=summand2.multi_action().actions();
           const data_expression actiontime2=summand2.multi_action().time();
@@ -8946,10 +8957,10 @@ class specification_basic_type
           const assignment_list& nextstate2=summand2.assignments();
           const stochastic_distribution& distribution2=summand2.distribution();
 
-          if ((multiaction1 == action_list({ terminationAction })) == (multiaction2 == action_list({ terminationAction })))
+          if (terminates1==terminates2[j])
           {
             action_list multiaction3;
-            if ((multiaction1 == action_list({ terminationAction })) && (multiaction2 == action_list({ terminationAction })))
+            if (terminates1)
             {
               multiaction3.push_front(terminationAction);
             }
@@ -11354,3 +11365,70 @@ mcrl2::lps::stochastic_specification mcrl2::lps::linearise(
   lps::complete_data_specification(spec1);
   return spec1;
 }
+
+/// \brief Returns a term that identifies the linearisation of spec with the given options.
+static atermpp::aterm_appl linearisation_cache_key(
+  const mcrl2::process::process_specification& spec,
+  const mcrl2::lps::t_lin_options& lin_options)
+{
+  std::ostringstream options;
+  options << lin_options.lin_method << " "
+          << lin_options.no_intermediate_cluster
+          << lin_options.final_cluster
+          << lin_options.newstate
+          << lin_options.binary
+          << lin_options.statenames
+          << lin_options.norewrite
+          << lin_options.noglobalvars
+          << lin_options.nosumelm
+          << lin_options.nodeltaelimination
+          << lin_options.ignore_time
+          << lin_options.do_not_apply_constelm
+          << lin_options.apply_alphabet_axioms
+          << lin_options.balance_summands << " "
+          << lin_options.rewrite_strategy;
+
+  return atermpp::aterm_appl(atermpp::function_symbol("linearisation_cache", 2),
+                             atermpp::aterm_appl(atermpp::function_symbol(options.str(), 0)),
+                             mcrl2::process::process_specification_to_aterm(spec));
+}
+
+mcrl2::lps::stochastic_specification mcrl2::lps::linearise(
+  const mcrl2::process::process_specification& type_checked_spec,
+  const mcrl2::lps::t_lin_options& lin_options,
+  const std::string& cache_filename)
+{
+  const atermpp::aterm_appl key = linearisation_cache_key(type_checked_spec, lin_options);
+
+  std::ifstream instream(cache_filename, std::ios_base::binary);
+  if (instream.good())
+  {
+    atermpp::binary_aterm_istream input(instream);
+    input >> data::detail::add_index_impl;
+
+    atermpp::aterm cached_key;
+    input >> cached_key;
+    if (cached_key == key)
+    {
+      stochastic_specification result;
+      input >> result;
+      mCRL2log(mcrl2::log::verbose) << "the linearisation is read from the cache " << cache_filename << ".\n";
+      return result;
+    }
+    mCRL2log(mcrl2::log::verbose) << "the cache " << cache_filename << " belongs to a different specification or different options.\n";
+  }
+  instream.close();
+
+  stochastic_specification result = linearise(type_checked_spec, lin_options);
+
+  std::ofstream outstream(cache_filename, std::ios_base::binary);
+  if (!outstream.good())
+  {
+    throw mcrl2::runtime_error("Could not open file " + cache_filename + ".");
+  }
+  atermpp::binary_aterm_ostream output(outstream);
+  output << data::detail::remove_index_impl;
+  output << key;
+  output << result;
+  return result;
+}
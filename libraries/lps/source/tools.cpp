@@ -157,6 +157,61 @@ bool lpsinvelm(const std::string& input_filename,
   return true;
 }
 
+/// \brief Returns a measure for the size of an LPS, which decreases when one of the
+/// optimisations of lpsoptimise succeeds.
+static
+std::size_t optimisation_measure(const stochastic_specification& spec)
+{
+  const stochastic_linear_process& process = spec.process();
+  std::size_t result = process.process_parameters().size() + process.summand_count();
+  for (const stochastic_action_summand& summand: process.action_summands())
+  {
+    result += summand.summation_variables().size();
+  }
+  for (const deadlock_summand& summand: process.deadlock_summands())
+  {
+    result += summand.summation_variables().size();
+  }
+  return result;
+}
+
+void lpsoptimise(const std::string& input_filename,
+                 const std::string& output_filename,
+                 data::rewriter::strategy rewrite_strategy
+                )
+{
+  lps::stochastic_specification spec;
+  load_lps(spec, input_filename);
+
+  // None of the optimisations changes the data specification, so the rewriter can be shared.
+  mcrl2::data::rewriter R(spec.data(), rewrite_strategy);
+
+  // Each optimisation can enable the others, e.g. removing a constant parameter can make
+  // another parameter superfluous. They are therefore repeated as long as the LPS shrinks.
+  std::size_t size = optimisation_measure(spec);
+  for (std::size_t round = 1; ; ++round)
+  {
+    lps::rewrite(spec, R);
+    lps::remove_trivial_summands(spec);
+    lps::remove_redundant_assignments(spec);
+    sumelm_algorithm<stochastic_specification>(spec, false).run();
+    constelm_algorithm<data::rewriter, stochastic_specification>(spec, R).run();
+    lps::parelm(spec, true);
+
+    const std::size_t new_size = optimisation_measure(spec);
+    mCRL2log(log::verbose) << "after round " << round << " the LPS has "
+                           << spec.process().process_parameters().size() << " parameters and "
+                           << spec.process().summand_count() << " summands" << std::endl;
+    if (new_size >= size)
+    {
+      break;
+    }
+    size = new_size;
+  }
+
+  save_lps(spec, output_filename);
+}
+
 void lpsparelm(const std::string& input_filename,
                const std::string& output_filename
               )
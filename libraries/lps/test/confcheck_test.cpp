@@ -199,3 +199,37 @@ BOOST_AUTO_TEST_CASE(case_5)
   run_confluence_test_case(s,5);
 }
 
+// Rerunning the checker with a proof cache should give the same result.
+BOOST_AUTO_TEST_CASE(proof_cache)
+{
+  const std::string s(
+    "act  a,b;\n"
+    "proc P(s3: Pos, n: Nat) =\n"
+    "       (s3 == 3) ->\n"
+    "         b .\n"
+    "         P(s3 = 4)\n"
+    "     + (s3 == 2) ->\n"
+    "         tau .\n"
+    "         P(s3 = 3)\n"
+    "     + (n < 10) ->\n"
+    "         tau .\n"
+    "         P(n = n + 1)\n"
+    "     + (s3 == 1) ->\n"
+    "         a .\n"
+    "         P(s3 = 2)\n"
+    "     + delta;\n"
+    "init P(1, 0);\n"
+  );
+
+  const std::string filename = "confcheck_test_proof_cache.out";
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    specification s0 = parse_linear_process_specification(s);
+    Confluence_Checker<specification> checker(s0, data::jitty, 0, false, data::detail::solver_type_cvc, false, true,
+                                              false, "c", false, false, std::string(), filename);
+    checker.check_confluence_and_mark(data::sort_bool::true_(), 0);
+    BOOST_CHECK_EQUAL(count_ctau(s0), 2u);
+  }
+  std::remove(filename.c_str());
+}
+
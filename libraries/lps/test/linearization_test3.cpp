@@ -15,6 +15,8 @@
 #include "mcrl2/data/detail/rewrite_strategies.h"
 #include "mcrl2/lps/linearise.h"
 
+#include <cstdio>
+
 using namespace mcrl2;
 using namespace mcrl2::lps;
 
@@ -181,6 +183,38 @@ BOOST_AUTO_TEST_CASE(linearisation_of_the_enclosed_spec_caused_a_name_conflict_w
   run_linearisation_test_case(spec,true);
 } 
 
+BOOST_AUTO_TEST_CASE(linearisation_cache)
+{
+  const std::string text =
+     "act\n"
+     "  a,b;\n"
+     "\n"
+     "proc\n"
+     "  P = a.P;\n"
+     "  Q = b.Q;\n"
+     "\n"
+     "init P || Q;\n";
+
+  const std::string cache_filename = "linearisation_cache_test.out";
+  std::remove(cache_filename.c_str());
+
+  t_lin_options options;
+  const process::process_specification spec = process::parse_process_specification(text);
+  const lps::stochastic_specification expected = linearise(spec, options);
+
+  // The first run fills the cache, the second run reads the result from the cache.
+  BOOST_CHECK(linearise(spec, options, cache_filename) == expected);
+  BOOST_CHECK(linearise(spec, options, cache_filename) == expected);
+
+  // Different options and a different specification are linearised again.
+  options.lin_method = lmStack;
+  BOOST_CHECK(linearise(spec, options, cache_filename) == linearise(spec, options));
+  const process::process_specification spec1 = process::parse_process_specification(text.substr(0, text.find("init")) + "init P;\n");
+  BOOST_CHECK(linearise(spec1, options, cache_filename) == linearise(spec1, options));
+
+  std::remove(cache_filename.c_str());
+}
+
 #else // ndef MCRL2_SKIP_LONG_TESTS
 
 BOOST_AUTO_TEST_CASE(skip_linearization_test)
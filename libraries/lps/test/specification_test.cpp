@@ -12,6 +12,7 @@
 #define BOOST_TEST_MODULE specification_test
 #include "mcrl2/lps/detail/test_input.h"
 #include "mcrl2/lps/find.h"
+#include "mcrl2/lps/io.h"
 #include "mcrl2/lps/linearise.h"
 #include "mcrl2/lps/parse.h"
 #include "mcrl2/lps/print.h"
@@ -62,9 +63,64 @@ void test_context_sorts()
   BOOST_CHECK(check_well_typedness(sspec));
 }
 
+// The strategies of the jitty rewriter can be embedded in an LPS, and are read back when it is loaded.
+void test_embedded_rewriter_state()
+{
+  specification spec = remove_stochastic_operators(linearise(lps::detail::ABP_SPECIFICATION()));
+  data::detail::jitty_strategies().clear();
+  data::rewriter r(spec.data(), data::jitty);
+  BOOST_CHECK(!data::detail::jitty_strategies().empty());
+
+  std::stringstream plain;
+  save_lps(spec, plain);
+
+  data::detail::embed_rewriter_state() = true;
+  std::stringstream embedded;
+  save_lps(spec, embedded);
+  data::detail::embed_rewriter_state() = false;
+  BOOST_CHECK(embedded.str().size() > plain.str().size());
+
+  data::detail::jitty_strategies().clear();
+  specification spec1;
+  load_lps(spec1, plain);
+  BOOST_CHECK(spec1 == spec);
+  BOOST_CHECK(data::detail::jitty_strategies().empty());
+
+  specification spec2;
+  load_lps(spec2, embedded);
+  BOOST_CHECK(spec2 == spec);
+  BOOST_CHECK(!data::detail::jitty_strategies().empty());
+
+  // The order of the rules does not matter when looking up a strategy.
+  const auto& equations = spec.data().equations();
+  std::size_t found = 0;
+  for (const data::function_symbol& f: spec.data().mappings())
+  {
+    data::data_equation_list rules;
+    for (const data::data_equation& eq: equations)
+    {
+      if (data::is_application(eq.lhs()) && atermpp::down_cast<data::application>(eq.lhs()).head() == f)
+      {
+        rules.push_front(eq);
+      }
+    }
+    if (rules.size() > 1)
+    {
+      const data::detail::strategy* s = data::detail::jitty_strategies().find(rules);
+      if (s != nullptr)
+      {
+        found++;
+        BOOST_CHECK(s == data::detail::jitty_strategies().find(atermpp::reverse(rules)));
+      }
+    }
+  }
+  BOOST_CHECK(found > 0);
+}
+
 BOOST_AUTO_TEST_CASE(test_main)
 {
   test_find_sort_expressions();
   test_system_defined_sorts();
   test_context_sorts();
+  test_embedded_rewriter_state();
 }
@@ -14,6 +14,7 @@
 #include "mcrl2/lts/detail/bithashtable.h"
 #include "mcrl2/lts/detail/queue.h"
 #include "mcrl2/lts/detail/lts_generation_options.h"
+#include "mcrl2/utilities/metrics.h"
 
 
 namespace mcrl2
@@ -101,6 +102,7 @@ class lps2lts_algorithm
     std::size_t m_num_transitions;
     next_state_generator::transition_t::state_probability_list m_initial_states;
     std::size_t m_level;
+    utilities::metric_histogram* m_outgoing_transitions_metric; // nullptr if no metrics are collected.
 
     std::unordered_set<lps::state> non_divergent_states;  // This set is filled with states proven not to be divergent,
                                                           // when lps2lts_algorithm is requested to search for divergencies.
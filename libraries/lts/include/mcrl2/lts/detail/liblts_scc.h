@@ -10,6 +10,12 @@
 
 #ifndef _LIBLTS_SCC_H
 #define _LIBLTS_SCC_H
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 #include "mcrl2/lts/lts.h"
 #include "mcrl2/utilities/logger.h"
@@ -121,6 +127,399 @@ namespace detail
       }
   };
 
+/// \brief The number of threads used by the scc partitioner if none is specified.
+/// \details Small transition systems are always partitioned sequentially, as
+///          starting threads does not pay off for them.
+inline std::size_t scc_default_number_of_threads(const std::size_t number_of_transitions)
+{
+  constexpr std::size_t minimal_number_of_transitions_for_parallel_scc = 1000000;
+  if (number_of_transitions < minimal_number_of_transitions_for_parallel_scc)
+  {
+    return 1;
+  }
+  return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/// \brief This class calculates the strongly connected components of the tau transitions of an lts
+///        using multiple threads.
+/// \details The algorithm is the forward-backward algorithm of L.K. Fleischer, B. Hendrickson and
+///          A. Pinar, On identifying strongly connected components in parallel, IPDPS 2000.
+///          The states are partitioned in subproblems, each identified by a colour. For a subproblem,
+///          first all states that cannot lie on a tau loop within the subproblem are trimmed off,
+///          as singleton components. Then a pivot is selected. The states that are forward and
+///          backward reachable from the pivot form its component. The states only forward reachable,
+///          the states only backward reachable, and the remaining states form three new independent
+///          subproblems, which are handed out to the available threads.
+///          Both the outgoing and the incoming tau transitions are stored in compressed sparse row
+///          format, using indexed_sorted_vector_for_tau_transitions.
+template <class LTS_TYPE>
+class parallel_scc_decomposition
+{
+  protected:
+    typedef std::size_t state_type;
+    typedef std::size_t colour_type;
+    typedef std::vector<state_type> subproblem;
+
+    /// \brief The colour of states for which the component is known.
+    static constexpr colour_type finished = std::numeric_limits<colour_type>::max();
+
+    /// \brief Subproblems smaller than this are not handed to other threads.
+    static constexpr std::size_t minimal_shared_subproblem_size = 1024;
+
+    const std::size_t m_number_of_threads;
+    indexed_sorted_vector_for_tau_transitions<LTS_TYPE> m_successors;
+    indexed_sorted_vector_for_tau_transitions<LTS_TYPE> m_predecessors;
+
+    // The colour of a state is only changed by the thread that owns the subproblem
+    // with this colour, but it is read by threads that own neighbouring subproblems.
+    std::vector<std::atomic<colour_type> > m_colour;
+    std::atomic<colour_type> m_next_colour;
+
+    // The entries below are only accessed by the thread owning the subproblem of a state.
+    std::vector<state_type> m_representative;
+    std::vector<std::size_t> m_in_degree;
+    std::vector<std::size_t> m_out_degree;
+
+    // The shared pool of subproblems.
+    std::mutex m_work_mutex;
+    std::condition_variable m_work_available;
+    std::vector<subproblem> m_work;
+    std::size_t m_number_of_busy_threads;
+
+    colour_type colour(const state_type s) const
+    {
+      return m_colour[s].load(std::memory_order_relaxed);
+    }
+
+    void set_colour(const state_type s, const colour_type c)
+    {
+      m_colour[s].store(c, std::memory_order_relaxed);
+    }
+
+    // Indicates that s is the representative of a singleton component.
+    void finish(const state_type s)
+    {
+      set_colour(s, finished);
+      m_representative[s] = s;
+    }
+
+    // Returns true iff s has a tau transition to or from another state.
+    bool has_other_neighbour(const state_type s,
+                             const indexed_sorted_vector_for_tau_transitions<LTS_TYPE>& neighbours) const
+    {
+      for (std::size_t i = neighbours.lowerbound(s); i < neighbours.upperbound(s); ++i)
+      {
+        if (neighbours.get_transitions()[i] != s)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Remove all states from the subproblem that cannot be on a tau loop within the
+    // subproblem. These form singleton components.
+    void trim(subproblem& states, const colour_type c)
+    {
+      std::vector<state_type> todo;
+      for (const state_type s: states)
+      {
+        std::size_t out = 0;
+        for (std::size_t i = m_successors.lowerbound(s); i < m_successors.upperbound(s); ++i)
+        {
+          const state_type t = m_successors.get_transitions()[i];
+          out += (t != s && colour(t) == c ? 1 : 0);
+        }
+        std::size_t in = 0;
+        for (std::size_t i = m_predecessors.lowerbound(s); i < m_predecessors.upperbound(s); ++i)
+        {
+          const state_type t = m_predecessors.get_transitions()[i];
+          in += (t != s && colour(t) == c ? 1 : 0);
+        }
+        m_out_degree[s] = out;
+        m_in_degree[s] = in;
+        if (out == 0 || in == 0)
+        {
+          todo.push_back(s);
+        }
+      }
+
+      while (!todo.empty())
+      {
+        const state_type s = todo.back();
+        todo.pop_back();
+        if (colour(s) != c)
+        {
+          continue; // s was already trimmed.
+        }
+        finish(s);
+        for (std::size_t i = m_predecessors.lowerbound(s); i < m_predecessors.upperbound(s); ++i)
+        {
+          const state_type t = m_predecessors.get_transitions()[i];
+          if (colour(t) == c && --m_out_degree[t] == 0)
+          {
+            todo.push_back(t);
+          }
+        }
+        for (std::size_t i = m_successors.lowerbound(s); i < m_successors.upperbound(s); ++i)
+        {
+          const state_type t = m_successors.get_transitions()[i];
+          if (colour(t) == c && --m_in_degree[t] == 0)
+          {
+            todo.push_back(t);
+          }
+        }
+      }
+
+      states.erase(std::remove_if(states.begin(), states.end(),
+                                  [&](const state_type s) { return colour(s) != c; }),
+                   states.end());
+    }
+
+    // Split off the component of the first state of the subproblem, and put the
+    // remaining independent subproblems in new_subproblems.
+    void split(subproblem& states, std::vector<subproblem>& new_subproblems)
+    {
+      const colour_type c = colour(states.front());
+      trim(states, c);
+      if (states.empty())
+      {
+        return;
+      }
+
+      const state_type pivot = states.front();
+      const colour_type forward_colour = m_next_colour++;
+      const colour_type backward_colour = m_next_colour++;
+
+      // Colour all states reachable from the pivot with the forward colour.
+      std::vector<state_type> stack(1, pivot);
+      set_colour(pivot, forward_colour);
+      while (!stack.empty())
+      {
+        const state_type s = stack.back();
+        stack.pop_back();
+        for (std::size_t i = m_successors.lowerbound(s); i < m_successors.upperbound(s); ++i)
+        {
+          const state_type t = m_successors.get_transitions()[i];
+          if (colour(t) == c)
+          {
+            set_colour(t, forward_colour);
+            stack.push_back(t);
+          }
+        }
+      }
+
+      // The states that are forward and backward reachable form the component of the pivot.
+      stack.push_back(pivot);
+      set_colour(pivot, finished);
+      m_representative[pivot] = pivot;
+      while (!stack.empty())
+      {
+        const state_type s = stack.back();
+        stack.pop_back();
+        for (std::size_t i = m_predecessors.lowerbound(s); i < m_predecessors.upperbound(s); ++i)
+        {
+          const state_type t = m_predecessors.get_transitions()[i];
+          const colour_type colour_t = colour(t);
+          if (colour_t == forward_colour)
+          {
+            set_colour(t, finished);
+            m_representative[t] = pivot;
+            stack.push_back(t);
+          }
+          else if (colour_t == c)
+          {
+            set_colour(t, backward_colour);
+            stack.push_back(t);
+          }
+        }
+      }
+
+      subproblem forward;
+      subproblem backward;
+      subproblem remaining;
+      for (const state_type s: states)
+      {
+        const colour_type colour_s = colour(s);
+        if (colour_s == forward_colour)
+        {
+          forward.push_back(s);
+        }
+        else if (colour_s == backward_colour)
+        {
+          backward.push_back(s);
+        }
+        else if (colour_s == c)
+        {
+          remaining.push_back(s);
+        }
+      }
+      subproblem().swap(states);
+
+      for (subproblem* p: { &forward, &backward, &remaining })
+      {
+        if (p->size() == 1)
+        {
+          finish(p->front());
+        }
+        else if (!p->empty())
+        {
+          new_subproblems.emplace_back(std::move(*p));
+        }
+      }
+    }
+
+    // Solve subproblems until no work is left for any of the threads.
+    void worker()
+    {
+      std::vector<subproblem> local_work;
+      std::vector<subproblem> new_subproblems;
+      std::unique_lock<std::mutex> lock(m_work_mutex);
+      while (true)
+      {
+        if (m_work.empty())
+        {
+          if (m_number_of_busy_threads == 0)
+          {
+            return;
+          }
+          m_work_available.wait(lock);
+          continue;
+        }
+
+        local_work.emplace_back(std::move(m_work.back()));
+        m_work.pop_back();
+        ++m_number_of_busy_threads;
+        lock.unlock();
+
+        while (!local_work.empty())
+        {
+          subproblem states = std::move(local_work.back());
+          local_work.pop_back();
+          split(states, new_subproblems);
+
+          // Large subproblems are shared with the other threads, small ones are solved locally.
+          bool shared_work = false;
+          for (subproblem& p: new_subproblems)
+          {
+            if (p.size() < minimal_shared_subproblem_size || m_number_of_threads == 1)
+            {
+              local_work.emplace_back(std::move(p));
+            }
+            else
+            {
+              if (!shared_work)
+              {
+                lock.lock();
+                shared_work = true;
+              }
+              m_work.emplace_back(std::move(p));
+            }
+          }
+          new_subproblems.clear();
+          if (shared_work)
+          {
+            lock.unlock();
+            m_work_available.notify_all();
+          }
+        }
+
+        lock.lock();
+        --m_number_of_busy_threads;
+        if (m_number_of_busy_threads == 0 && m_work.empty())
+        {
+          m_work_available.notify_all();
+        }
+      }
+    }
+
+    // Apply f to all states, distributing the states evenly over the threads.
+    template <typename Function>
+    void for_all_states(const std::size_t number_of_states, Function f)
+    {
+      std::vector<std::thread> threads;
+      const std::size_t chunk = (number_of_states + m_number_of_threads - 1) / m_number_of_threads;
+      for (std::size_t i = 1; i < m_number_of_threads; ++i)
+      {
+        threads.emplace_back([&, i]()
+        {
+          for (state_type s = i * chunk; s < std::min((i + 1) * chunk, number_of_states); ++s)
+          {
+            f(s);
+          }
+        });
+      }
+      for (state_type s = 0; s < std::min(chunk, number_of_states); ++s)
+      {
+        f(s);
+      }
+      for (std::thread& t: threads)
+      {
+        t.join();
+      }
+    }
+
+  public:
+    /// \brief Calculate the tau components of the lts with the given number of threads.
+    parallel_scc_decomposition(const LTS_TYPE& aut, const std::size_t number_of_threads)
+      : m_number_of_threads(std::max<std::size_t>(1, number_of_threads)),
+        m_successors(aut, true),
+        m_predecessors(aut, false),
+        m_colour(aut.num_states()),
+        m_next_colour(1),
+        m_representative(aut.num_states()),
+        m_in_degree(aut.num_states()),
+        m_out_degree(aut.num_states()),
+        m_number_of_busy_threads(0)
+    {
+      // States without tau transitions to or from other states are trivial components. These are
+      // removed in parallel, as they form the bulk of the states of most transition systems.
+      for_all_states(aut.num_states(), [this](const state_type s)
+      {
+        if (has_other_neighbour(s, m_successors) && has_other_neighbour(s, m_predecessors))
+        {
+          set_colour(s, 0);
+        }
+        else
+        {
+          finish(s);
+        }
+      });
+
+      subproblem initial;
+      for (state_type s = 0; s < aut.num_states(); ++s)
+      {
+        if (colour(s) == 0)
+        {
+          initial.push_back(s);
+        }
+      }
+      if (!initial.empty())
+      {
+        m_work.emplace_back(std::move(initial));
+      }
+
+      std::vector<std::thread> threads;
+      for (std::size_t i = 1; i < m_number_of_threads; ++i)
+      {
+        threads.emplace_back([this]() { worker(); });
+      }
+      worker();
+      for (std::thread& t: threads)
+      {
+        t.join();
+      }
+    }
+
+    /// \brief The representative of the component of state s. Two states are in the same
+    ///        component iff they have the same representative.
+    state_type representative(const state_type s) const
+    {
+      assert(colour(s) == finished);
+      return m_representative[s];
+    }
+};
+
 /// \brief This class contains an scc partitioner removing inert tau loops.
 
 template < class LTS_TYPE>
@@ -140,8 +539,12 @@ class scc_partitioner
      *  When applying the function \ref replace_transition_system the
      *  automaton l is replaced by (aka shrinked to) the automaton modulo the
      *  calculated partition.
-     *  \param[in] l reference to an LTS. */
-    scc_partitioner(LTS_TYPE& l);
+     *  If more than one thread is used, the parallel algorithm in
+     *  \ref parallel_scc_decomposition is used instead.
+     *  \param[in] l reference to an LTS.
+     *  \param[in] number_of_threads The number of threads to be used. If 0, the number of threads
+     *     is determined by \ref scc_default_number_of_threads. */
+    scc_partitioner(LTS_TYPE& l, std::size_t number_of_threads = 0);
 
     /** \brief Destroys this partitioner. */
     ~scc_partitioner()=default;
@@ -203,12 +606,13 @@ class scc_partitioner
     void dfs_numbering(const state_type t,
                        const indexed_sorted_vector_for_tau_transitions<LTS_TYPE>& src_tgt,
                        std::vector < bool >& visited);
+    void parallel_partitioning(const std::size_t number_of_threads);
 
 };
 
 
 template < class LTS_TYPE>
-scc_partitioner<LTS_TYPE>::scc_partitioner(LTS_TYPE& l)
+scc_partitioner<LTS_TYPE>::scc_partitioner(LTS_TYPE& l, std::size_t number_of_threads)
   :aut(l),
     block_index_of_a_state(aut.num_states(),0),
     equivalence_class_index(0)
@@ -216,6 +620,16 @@ scc_partitioner<LTS_TYPE>::scc_partitioner(LTS_TYPE& l)
   mCRL2log(log::debug) << "Tau loop (SCC) partitioner created for " << l.num_states() << " states and " <<
               l.num_transitions() << " transitions" << std::endl;
 
+  if (number_of_threads == 0)
+  {
+    number_of_threads = scc_default_number_of_threads(l.num_transitions());
+  }
+  if (number_of_threads > 1)
+  {
+    parallel_partitioning(number_of_threads);
+    return;
+  }
+
   dfsn2state.reserve(aut.num_states());
 
   // Initialise the data structures used in the recursive DFS procedure.
@@ -318,6 +732,28 @@ bool scc_partitioner<LTS_TYPE>::in_same_class(const std::size_t s, const std::si
 
 // Private methods of scc_partitioner
 
+template < class LTS_TYPE>
+void scc_partitioner<LTS_TYPE>::parallel_partitioning(const std::size_t number_of_threads)
+{
+  mCRL2log(log::debug) << "Tau loop (SCC) partitioner uses " << number_of_threads << " threads." << std::endl;
+  const parallel_scc_decomposition<LTS_TYPE> components(aut, number_of_threads);
+
+  // Number the equivalence classes in the order in which they are encountered, such that the
+  // result does not depend on the scheduling of the threads.
+  const state_type undefined = std::numeric_limits<state_type>::max();
+  std::vector<state_type> class_of_representative(aut.num_states(), undefined);
+  for (state_type s = 0; s < aut.num_states(); ++s)
+  {
+    state_type& c = class_of_representative[components.representative(s)];
+    if (c == undefined)
+    {
+      c = equivalence_class_index++;
+    }
+    block_index_of_a_state[s] = c;
+  }
+  mCRL2log(log::debug) << "Tau loop (SCC) partitioner reduces lts to " << equivalence_class_index << " states." << std::endl;
+}
+
 template < class LTS_TYPE>
 void scc_partitioner<LTS_TYPE>::group_components(
   const state_type s,
@@ -360,9 +796,9 @@ void scc_partitioner<LTS_TYPE>::dfs_numbering(
 } // namespace detail
 
 template < class LTS_TYPE>
-void scc_reduce(LTS_TYPE& l,const bool preserve_divergence_loops = false)
+void scc_reduce(LTS_TYPE& l,const bool preserve_divergence_loops = false, const std::size_t number_of_threads = 0)
 {
-  detail::scc_partitioner<LTS_TYPE> scc_part(l);
+  detail::scc_partitioner<LTS_TYPE> scc_part(l, number_of_threads);
   scc_part.replace_transition_system(preserve_divergence_loops);
 }
 
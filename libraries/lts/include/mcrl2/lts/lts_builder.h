@@ -212,12 +212,32 @@ class lts_lts_builder: public lts_builder
     }
 };
 
+// Write transitions immediately to disk in compact blocks, preceded by the action labels that they use.
 class lts_lts_disk_builder: public lts_builder
 {
   protected:
+    static constexpr std::size_t transition_block_size = 1 << 16;
+
     std::fstream fstream;
     std::unique_ptr<atermpp::binary_aterm_ostream> stream;
     bool m_discard_state_labels = false;
+    std::vector<transition> m_transition_block;
+    std::size_t m_number_of_written_action_labels = 0;
+
+    void write_new_action_labels(const process::timed_multi_action& a, std::size_t label)
+    {
+      if (label == m_number_of_written_action_labels)
+      {
+        write_action_label(*stream, a.sort_actions());
+        m_number_of_written_action_labels++;
+      }
+    }
+
+    void flush_transition_block()
+    {
+      write_transition_block(*stream, m_transition_block);
+      m_transition_block.clear();
+    }
 
   public:
     lts_lts_disk_builder(
@@ -239,16 +259,31 @@ class lts_lts_disk_builder: public lts_builder
       stream = std::make_unique<atermpp::binary_aterm_ostream>(fstream);
 
       mcrl2::lts::write_lts_header(*stream, dataspec, process_parameters, action_labels);
+
+      // The action labels must be written in the order of their indices, starting with tau.
+      for (const auto& p: m_actions)
+      {
+        write_new_action_labels(p.first, p.second);
+      }
+      m_transition_block.reserve(transition_block_size);
     }
 
     void add_transition(std::size_t from, const process::timed_multi_action& a, std::size_t to) override
     {
-      write_transition(*stream, from, a, to);
+      std::size_t label = add_action(a);
+      write_new_action_labels(a, label);
+      m_transition_block.emplace_back(from, label, to);
+      if (m_transition_block.size() == transition_block_size)
+      {
+        flush_transition_block();
+      }
     }
 
     // Add actions and states to the LTS
     void finalize(const utilities::indexed_set<lps::state>& state_map, bool timed) override
     {
+      flush_transition_block();
+
       if (!m_discard_state_labels)
       {
         // Write the state labels in the order of their indices.
@@ -295,6 +295,8 @@ atermpp::aterm_ostream& operator<<(atermpp::aterm_ostream& stream, const probabi
 //
 // In any order:
 //  Write transitions (to, label, from), where 'to' and 'from' are indices and 'label' the timed_multi_action, as necessary.
+//  Alternatively, write the action labels with write_action_label and write the transitions, with the indices of their
+//  action labels, in compact blocks using write_transition_block.
 //  Write state labels (state_label_lts) in their order such that writing the i-th state label belongs to state with index i.
 //  Write the initial state.
 
@@ -308,6 +310,16 @@ void write_lts_header(atermpp::aterm_ostream& stream,
 void write_transition(atermpp::aterm_ostream& stream, std::size_t from, const process::timed_multi_action& label, std::size_t to);
 void write_transition(atermpp::aterm_ostream& stream, std::size_t from, const process::timed_multi_action& label, const probabilistic_lts_lts_t::probabilistic_state_t& to);
 
+/// \brief Write an action label to the LTS stream. The action labels written in this way are numbered
+///        0, 1, 2, ... in the order in which they are written. These numbers are used as labels in transition blocks.
+void write_action_label(atermpp::aterm_ostream& stream, const process::timed_multi_action& label);
+
+/// \brief Write a block of transitions to the LTS stream, whose labels refer to action labels written earlier.
+/// \details The transitions are stored compactly. Consecutive transitions with the same source state share
+///          the source, which is stored relative to the previous source. The targets are stored relative to
+///          the source. All numbers are written as variable width integers. Each block can be decoded on its own.
+void write_transition_block(atermpp::aterm_ostream& stream, const std::vector<transition>& transitions);
+
 /// \brief Write a state label to the LTS stream.
 void write_state_label(atermpp::aterm_ostream& stream, const state_label_lts& label);
 
@@ -0,0 +1,135 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lts/lts_reducing_builder.h
+/// \brief An lts builder that reduces the generated lts before it is saved.
+
+#ifndef MCRL2_LTS_LTS_REDUCING_BUILDER_H
+#define MCRL2_LTS_LTS_REDUCING_BUILDER_H
+
+#include <thread>
+#include <unordered_set>
+#include "mcrl2/lts/lts_algorithm.h"
+#include "mcrl2/lts/lts_builder.h"
+#include "mcrl2/utilities/detail/bounded_buffer.h"
+
+namespace mcrl2 {
+
+namespace lts {
+
+/// \brief Stores the generated lts in memory and reduces it modulo an equivalence before saving it.
+/// \details Generating an lts and reducing it with ltsconvert requires that the full lts is
+///          written to disk and read back. This builder avoids that. The transitions are passed
+///          in batches through a bounded buffer to a separate thread that stores them, while
+///          the exploration proceeds. Only the action labels are handled by the exploring thread,
+///          as terms cannot be shared between threads. Duplicate transitions from the same
+///          source state, which are frequently generated by different summands, are removed
+///          before they are stored.
+/// \tparam LTSBuilder An lts builder that stores the lts in its member m_lts, i.e.
+///          lts_aut_builder or lts_lts_builder.
+template <typename LTSBuilder>
+class lts_reducing_builder: public LTSBuilder
+{
+  protected:
+    typedef LTSBuilder super;
+    typedef std::vector<transition> transition_batch;
+    using super::m_lts;
+
+    static constexpr std::size_t batch_size = 4096;
+    static constexpr std::size_t maximal_number_of_batches = 64;
+
+    lts_equivalence m_equivalence;
+    transition_batch m_batch;
+    utilities::detail::bounded_buffer<transition_batch> m_buffer;
+    std::thread m_storage_thread;
+
+    // Move the transitions from the buffer into the lts. This runs in a separate thread.
+    void store_transitions()
+    {
+      const std::size_t no_state = std::numeric_limits<std::size_t>::max();
+      std::size_t current_source = no_state;
+      std::unordered_set<transition> outgoing_transitions;
+      transition_batch batch;
+      while (m_buffer.pop(batch))
+      {
+        for (const transition& t: batch)
+        {
+          // The explorer generates all outgoing transitions of a state consecutively.
+          if (t.from() != current_source)
+          {
+            current_source = t.from();
+            outgoing_transitions.clear();
+          }
+          if (outgoing_transitions.insert(t).second)
+          {
+            m_lts.add_transition(t);
+          }
+        }
+      }
+    }
+
+    void flush_batch()
+    {
+      if (!m_batch.empty())
+      {
+        m_buffer.push(std::move(m_batch));
+        m_batch = transition_batch();
+        m_batch.reserve(batch_size);
+      }
+    }
+
+  public:
+    template <typename... Args>
+    explicit lts_reducing_builder(lts_equivalence equivalence, Args&&... args)
+      : super(std::forward<Args>(args)...),
+        m_equivalence(equivalence),
+        m_buffer(maximal_number_of_batches)
+    {
+      m_batch.reserve(batch_size);
+      m_storage_thread = std::thread([this]() { store_transitions(); });
+    }
+
+    ~lts_reducing_builder() override
+    {
+      if (m_storage_thread.joinable())
+      {
+        m_buffer.close();
+        m_storage_thread.join();
+      }
+    }
+
+    void add_transition(std::size_t from, const process::timed_multi_action& a, std::size_t to) override
+    {
+      m_batch.emplace_back(from, this->add_action(a), to);
+      if (m_batch.size() == batch_size)
+      {
+        flush_batch();
+      }
+    }
+
+    // Wait until all transitions are stored, add actions and states, and reduce the lts.
+    void finalize(const utilities::indexed_set<lps::state>& state_map, bool timed) override
+    {
+      flush_batch();
+      m_buffer.close();
+      m_storage_thread.join();
+
+      super::finalize(state_map, timed);
+      mCRL2log(log::verbose) << "reducing the generated lts with " << m_lts.num_states() << " states and "
+                             << m_lts.num_transitions() << " transitions modulo " << description(m_equivalence) << "." << std::endl;
+      reduce(m_lts, m_equivalence);
+      mCRL2log(log::verbose) << "the reduced lts has " << m_lts.num_states() << " states and "
+                             << m_lts.num_transitions() << " transitions." << std::endl;
+    }
+};
+
+} // namespace lts
+
+} // namespace mcrl2
+
+#endif // MCRL2_LTS_LTS_REDUCING_BUILDER_H
@@ -10,9 +10,8 @@
 /** \file
  *
  * \brief This file contains a class that contains labels for probabilistic transitions.
- *        These consist of a 64 bit enumerator and denominator. This library maintains
- *        precision as long as the enuemerator and denominator fit in 64 bits positive numbers.
- *        If they do not fit, rounding is applied.
+ *        These consist of an enumerator and a denominator of arbitrary size, which are
+ *        stored as 64 bit numbers as long as they fit.
  * \author Jan Friso Groote
  */
 
@@ -21,6 +20,7 @@
 #define MCRL2_LTS_PROBABILISTIC_ARBITRARY_PRECISION_FRACTION_H
 
 #include "mcrl2/utilities/big_numbers.h"
+#include <numeric>
 
 
 namespace mcrl2
@@ -30,10 +30,21 @@ namespace lts
 
 /** \brief This class contains labels for probabilistic transistions, consisting of a numerator and a denominator
  *         as a string of digits.
+ *  \details Most probabilities have a small enumerator and denominator. As long as these fit in a std::size_t
+ *           they are stored as such, and calculations are carried out using machine arithmetic. Only if a result
+ *           does not fit, big natural numbers are used. The representation is unique, i.e. a fraction uses big
+ *           natural numbers if and only if its enumerator or denominator does not fit in a std::size_t.
  */
 class probabilistic_arbitrary_precision_fraction
 {
+  friend std::hash<probabilistic_arbitrary_precision_fraction>;
+
   protected:
+    // If m_is_small holds, the fraction is m_small_enumerator/m_small_denominator, and otherwise it is
+    // m_enumerator/m_denominator.
+    bool m_is_small;
+    std::size_t m_small_enumerator;
+    std::size_t m_small_denominator;
     utilities::big_natural_number m_enumerator;
     utilities::big_natural_number m_denominator;
 
@@ -57,6 +68,131 @@ class probabilistic_arbitrary_precision_fraction
       return buffer;
     }
 
+    probabilistic_arbitrary_precision_fraction(std::size_t enumerator, std::size_t denominator, bool /* small */)
+     : m_is_small(true),
+       m_small_enumerator(enumerator),
+       m_small_denominator(denominator)
+    {
+      assert(enumerator<=denominator);
+    }
+
+    // Use the small representation if the enumerator and the denominator fit in a std::size_t.
+    void normalise_representation()
+    {
+      if (m_enumerator.is_machine_number() && m_denominator.is_machine_number())
+      {
+        m_is_small=true;
+        m_small_enumerator=static_cast<std::size_t>(m_enumerator);
+        m_small_denominator=static_cast<std::size_t>(m_denominator);
+        m_enumerator.clear();
+        m_denominator.clear();
+      }
+      else
+      {
+        m_is_small=false;
+      }
+    }
+
+    // Returns this fraction with its enumerator and denominator stored as big natural numbers.
+    probabilistic_arbitrary_precision_fraction promote() const
+    {
+      probabilistic_arbitrary_precision_fraction result(*this);
+      if (m_is_small)
+      {
+        result.m_is_small=false;
+        result.m_enumerator=utilities::big_natural_number(m_small_enumerator);
+        result.m_denominator=utilities::big_natural_number(m_small_denominator);
+      }
+      return result;
+    }
+
+    // Calculate result:=x*y. Returns false if the result does not fit in a std::size_t.
+    static bool multiply_small(std::size_t x, std::size_t y, std::size_t& result)
+    {
+      std::size_t carry=0;
+      result=utilities::detail::multiply_single_number(x,y,carry);
+      return carry==0;
+    }
+
+    // Calculate result:=x+y. Returns false if the result does not fit in a std::size_t.
+    static bool add_small(std::size_t x, std::size_t y, std::size_t& result)
+    {
+      std::size_t carry=0;
+      result=utilities::detail::add_single_number(x,y,carry);
+      return carry==0;
+    }
+
+    // Returns the fraction enumerator/denominator without common factors.
+    static probabilistic_arbitrary_precision_fraction make_small(std::size_t enumerator, std::size_t denominator)
+    {
+      const std::size_t gcd=std::gcd(enumerator,denominator);
+      return probabilistic_arbitrary_precision_fraction(enumerator/gcd, denominator/gcd, true);
+    }
+
+    // Compares x1*y1 and x2*y2, where the products are calculated with twice the number of bits of a std::size_t.
+    static int compare_small_products(std::size_t x1, std::size_t y1, std::size_t x2, std::size_t y2)
+    {
+      std::size_t high1=0;
+      const std::size_t low1=utilities::detail::multiply_single_number(x1,y1,high1);
+      std::size_t high2=0;
+      const std::size_t low2=utilities::detail::multiply_single_number(x2,y2,high2);
+      if (high1!=high2)
+      {
+        return high1<high2?-1:1;
+      }
+      if (low1!=low2)
+      {
+        return low1<low2?-1:1;
+      }
+      return 0;
+    }
+
+    // Calculate x1/y1 + x2/y2 (or x1/y1 - x2/y2 if subtract holds) in result. Returns false if an
+    // intermediate result does not fit in a std::size_t.
+    static bool add_small_fractions(std::size_t x1, std::size_t y1, std::size_t x2, std::size_t y2, bool subtract,
+                                    probabilistic_arbitrary_precision_fraction& result)
+    {
+      // x1/y1 + x2/y2 = (x1*(y2/g) + x2*(y1/g)) / (y1*(y2/g)) where g=gcd(y1,y2).
+      const std::size_t gcd=std::gcd(y1,y2);
+      std::size_t enumerator1, enumerator2, denominator;
+      if (!multiply_small(x1,y2/gcd,enumerator1) ||
+          !multiply_small(x2,y1/gcd,enumerator2) ||
+          !multiply_small(y1,y2/gcd,denominator))
+      {
+        return false;
+      }
+      std::size_t enumerator;
+      if (subtract)
+      {
+        assert(enumerator1>=enumerator2);
+        enumerator=enumerator1-enumerator2;
+      }
+      else if (!add_small(enumerator1,enumerator2,enumerator))
+      {
+        return false;
+      }
+      result=make_small(enumerator,denominator);
+      return true;
+    }
+
+    // Calculate (x1/y1) * (x2/y2) in result. Returns false if an intermediate result does not fit in a std::size_t.
+    static bool multiply_small_fractions(std::size_t x1, std::size_t y1, std::size_t x2, std::size_t y2,
+                                         probabilistic_arbitrary_precision_fraction& result)
+    {
+      // Cross cancel common factors first, to avoid that the products overflow needlessly.
+      const std::size_t gcd1=std::gcd(x1,y2);
+      const std::size_t gcd2=std::gcd(x2,y1);
+      std::size_t enumerator, denominator;
+      if (gcd1==0 || gcd2==0 ||
+          !multiply_small(x1/gcd1,x2/gcd2,enumerator) ||
+          !multiply_small(y1/gcd2,y2/gcd1,denominator))
+      {
+        return false;
+      }
+      result=make_small(enumerator,denominator);
+      return true;
+    }
+
   public:
 
     /// \brief Constant zero.
@@ -76,48 +212,66 @@ class probabilistic_arbitrary_precision_fraction
     /* \brief Default constructor. The label will contain the default string.
      */
     probabilistic_arbitrary_precision_fraction()
-     : m_enumerator(),
-       m_denominator(utilities::big_natural_number(1))
+     : m_is_small(true),
+       m_small_enumerator(0),
+       m_small_denominator(1)
     {}
 
     /* \brief A constructor, where the enumerator and denominator are constructed
      *        from two strings of digits.
      */
     probabilistic_arbitrary_precision_fraction(const utilities::big_natural_number& enumerator, const utilities::big_natural_number& denominator)
-     : m_enumerator(enumerator),
+     : m_is_small(false),
+       m_small_enumerator(0),
+       m_small_denominator(1),
+       m_enumerator(enumerator),
        m_denominator(denominator)
     {
       assert(enumerator<= denominator);
+      normalise_representation();
     }
 
     /* \brief A constructor, where the enumerator and denominator are constructed
      *        from two strings of digits.
      */
     explicit probabilistic_arbitrary_precision_fraction(const std::string& enumerator, const std::string& denominator)
-     : m_enumerator(utilities::big_natural_number(enumerator)),
-       m_denominator(utilities::big_natural_number(denominator))
-    {
-      assert(m_enumerator<= m_denominator);
-    }
+     : probabilistic_arbitrary_precision_fraction(utilities::big_natural_number(enumerator), utilities::big_natural_number(denominator))
+    {}
 
     /* \brief Return the enumerator of the fraction.
     */
-    const utilities::big_natural_number& enumerator() const
+    utilities::big_natural_number enumerator() const
     {
-      return m_enumerator;
+      return m_is_small?utilities::big_natural_number(m_small_enumerator):m_enumerator;
     }
 
     /* \brief Return the denominator of the label.
     */
-    const utilities::big_natural_number& denominator() const
+    utilities::big_natural_number denominator() const
     {
-      return m_denominator;
+      return m_is_small?utilities::big_natural_number(m_small_denominator):m_denominator;
+    }
+
+    /* \brief Returns whether the enumerator and the denominator fit in a std::size_t.
+    */
+    bool is_small() const
+    {
+      return m_is_small;
     }
 
     /* \brief Standard comparison operator.
     */
     bool operator==(const probabilistic_arbitrary_precision_fraction& other) const
     {
+      if (m_is_small && other.m_is_small)
+      {
+        return compare_small_products(m_small_enumerator,other.m_small_denominator,other.m_small_enumerator,m_small_denominator)==0;
+      }
+      if (m_is_small || other.m_is_small)
+      {
+        return promote()==other.promote();
+      }
+
       // return this->m_enumerator*other.m_denominator==other.m_enumerator*this->m_denominator;
       buffer1().clear();
       this->m_enumerator.multiply(other.m_denominator, buffer1(), buffer3());
@@ -137,6 +291,15 @@ class probabilistic_arbitrary_precision_fraction
     */
     bool operator<(const probabilistic_arbitrary_precision_fraction& other) const
     {
+      if (m_is_small && other.m_is_small)
+      {
+        return compare_small_products(m_small_enumerator,other.m_small_denominator,other.m_small_enumerator,m_small_denominator)<0;
+      }
+      if (m_is_small || other.m_is_small)
+      {
+        return promote()<other.promote();
+      }
+
       // return this->m_enumerator*other.m_denominator<other.m_enumerator*this->m_denominator;
       buffer1().clear();
       this->m_enumerator.multiply(other.m_denominator, buffer1(), buffer3());
@@ -170,6 +333,17 @@ class probabilistic_arbitrary_precision_fraction
      */
     probabilistic_arbitrary_precision_fraction operator+(const probabilistic_arbitrary_precision_fraction& other) const
     {
+      probabilistic_arbitrary_precision_fraction result;
+      if (m_is_small && other.m_is_small &&
+          add_small_fractions(m_small_enumerator,m_small_denominator,other.m_small_enumerator,other.m_small_denominator,false,result))
+      {
+        return result;
+      }
+      if (m_is_small || other.m_is_small)
+      {
+        return promote()+other.promote();
+      }
+
       /* utilities::big_natural_number enumerator=this->enumerator()*other.denominator() +
                                                other.enumerator()*this->denominator();
       utilities::big_natural_number denominator=this->denominator()*other.denominator();
@@ -191,6 +365,17 @@ class probabilistic_arbitrary_precision_fraction
      */
     probabilistic_arbitrary_precision_fraction operator-(const probabilistic_arbitrary_precision_fraction& other) const
     {
+      probabilistic_arbitrary_precision_fraction result;
+      if (m_is_small && other.m_is_small &&
+          add_small_fractions(m_small_enumerator,m_small_denominator,other.m_small_enumerator,other.m_small_denominator,true,result))
+      {
+        return result;
+      }
+      if (m_is_small || other.m_is_small)
+      {
+        return promote()-other.promote();
+      }
+
       /* utilities::big_natural_number enumerator= this->enumerator()*other.denominator() -
                                     other.enumerator()*this->denominator();
       utilities::big_natural_number denominator=this->denominator()*other.denominator();
@@ -212,6 +397,17 @@ class probabilistic_arbitrary_precision_fraction
      */
     probabilistic_arbitrary_precision_fraction operator*(const probabilistic_arbitrary_precision_fraction& other) const
     {
+      probabilistic_arbitrary_precision_fraction result;
+      if (m_is_small && other.m_is_small &&
+          multiply_small_fractions(m_small_enumerator,m_small_denominator,other.m_small_enumerator,other.m_small_denominator,result))
+      {
+        return result;
+      }
+      if (m_is_small || other.m_is_small)
+      {
+        return promote()*other.promote();
+      }
+
       /* utilities::big_natural_number enumerator= this->enumerator()*other.enumerator();
       utilities::big_natural_number denominator=this->denominator()*other.denominator();
       remove_common_factors(enumerator,denominator);
@@ -229,6 +425,18 @@ class probabilistic_arbitrary_precision_fraction
      */
     probabilistic_arbitrary_precision_fraction operator/(const probabilistic_arbitrary_precision_fraction& other) const
     {
+      assert(other>probabilistic_arbitrary_precision_fraction::zero());
+      probabilistic_arbitrary_precision_fraction result;
+      if (m_is_small && other.m_is_small &&
+          multiply_small_fractions(m_small_enumerator,m_small_denominator,other.m_small_denominator,other.m_small_enumerator,result))
+      {
+        return result;
+      }
+      if (m_is_small || other.m_is_small)
+      {
+        return promote()/other.promote();
+      }
+
       /* assert(other>probabilistic_arbitrary_precision_fraction::zero());
       utilities::big_natural_number enumerator= this->enumerator()*other.denominator();
       utilities::big_natural_number denominator=this->denominator()*other.enumerator();
@@ -325,8 +533,13 @@ struct hash< mcrl2::lts::probabilistic_arbitrary_precision_fraction >
 {
   std::size_t operator()(const mcrl2::lts::probabilistic_arbitrary_precision_fraction& p) const
   {
+    if (p.is_small())
+    {
+      hash<std::size_t> hasher;
+      return mcrl2::utilities::detail::hash_combine(hasher(p.m_small_enumerator), hasher(p.m_small_denominator));
+    }
     hash<mcrl2::utilities::big_natural_number> hasher;
-    return mcrl2::utilities::detail::hash_combine(hasher(p.enumerator()), hasher(p.denominator()));
+    return mcrl2::utilities::detail::hash_combine(hasher(p.m_enumerator), hasher(p.m_denominator));
   }
 };
 
@@ -105,6 +105,7 @@ void lps2lts_algorithm::initialise_lts_generation(const lts_generation_options&
   m_num_transitions = 0;
   m_level = 1;
   m_traces_saved = 0;
+  m_outgoing_transitions_metric = utilities::metrics().enabled() ? &utilities::metrics().histogram("explorer.outgoing_transitions") : nullptr;
 
   m_maintain_traces = m_options.trace || m_options.save_error_trace;
   m_value_prioritize = (m_options.expl_strat == es_value_prioritized || m_options.expl_strat == es_value_random_prioritized);
@@ -304,6 +305,7 @@ void set_seed_random_generator()
 
 bool lps2lts_algorithm::generate_lts(const lts_generation_options& options)
 {
+  utilities::metrics_phase phase("explorer.exploration");
   initialise_lts_generation(options);
   // First generate a vector of initial states from the initial distribution.
   m_initial_states=m_generator->initial_states();
@@ -406,6 +408,13 @@ bool lps2lts_algorithm::generate_lts(const lts_generation_options& options)
     return false;
   }
 
+  if (utilities::metrics().enabled())
+  {
+    utilities::metrics().set_gauge("explorer.states", m_num_states);
+    utilities::metrics().set_gauge("explorer.transitions", m_num_transitions);
+    utilities::metrics().set_gauge("explorer.levels", m_level - 1);
+  }
+
   finalise_lts_generation();
   return true;
 }
@@ -1096,6 +1105,10 @@ void lps2lts_algorithm::get_transitions(const lps::state& state,
     {
       transitions.push_back(*it++);
     }
+    if (m_outgoing_transitions_metric != nullptr)
+    {
+      m_outgoing_transitions_metric->record(transitions.size());
+    }
   }
   catch (mcrl2::runtime_error& e)
   {
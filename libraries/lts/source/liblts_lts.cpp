@@ -11,6 +11,7 @@
 #include "mcrl2/lts/lts_lts.h"
 #include "mcrl2/lts/lts_io.h"
 
+#include <algorithm>
 #include <fstream>
 #include <optional>
 
@@ -58,6 +59,9 @@ namespace detail
 
 using namespace atermpp;
 
+/// \brief The maximal number of transitions in a transition block written by write_lts.
+static constexpr std::size_t transition_block_size = 1 << 16;
+
 // Special terms to indicate the type of the following structure.
 
 static atermpp::aterm transition_mark()
@@ -72,6 +76,18 @@ static atermpp::aterm probabilistic_transition_mark()
   return mark;
 }
 
+static atermpp::aterm action_label_mark()
+{
+  static atermpp::aterm_appl mark(atermpp::function_symbol("action_label", 0));
+  return mark;
+}
+
+static atermpp::aterm transition_block_mark()
+{
+  static atermpp::aterm_appl mark(atermpp::function_symbol("transition_block", 0));
+  return mark;
+}
+
 static atermpp::aterm initial_state_mark()
 {
   static atermpp::aterm_appl mark(atermpp::function_symbol("initial_state", 0));
@@ -85,6 +101,25 @@ static atermpp::aterm labelled_transition_system_mark()
 
 // Utility functions
 
+/// \brief Maps a difference between two indices to a natural number, such that small differences
+///        of either sign are mapped to small numbers.
+static std::size_t encode_difference(std::size_t from, std::size_t to)
+{
+  return to >= from ? (to - from) << 1 : ((from - to) << 1) - 1;
+}
+
+static std::size_t decode_difference(std::size_t from, std::size_t difference)
+{
+  return (difference & 1) == 0 ? from + (difference >> 1) : from - ((difference + 1) >> 1);
+}
+
+static std::size_t read_index(atermpp::aterm_istream& stream)
+{
+  atermpp::aterm_int value;
+  stream >> value;
+  return value.value();
+}
+
 static void set_initial_state(lts_lts_t& lts, const probabilistic_lts_lts_t::probabilistic_state_t& initial_state)
 {
   if (initial_state.size() > 1)
@@ -135,6 +170,9 @@ static void read_lts(atermpp::aterm_istream& stream, LTS& lts)
   mcrl2::utilities::indexed_set<action_label_lts> multi_actions;
   multi_actions.insert(action_label_lts::tau_action()); // This action list represents 'tau'.
 
+  // The indices of the action labels that are written separately, used by transition blocks.
+  std::vector<std::size_t> block_action_labels;
+
   // The initial state is stored and set as last.
   std::optional<probabilistic_lts_lts_t::probabilistic_state_t> initial_state;
 
@@ -182,6 +220,56 @@ static void read_lts(atermpp::aterm_istream& stream, LTS& lts)
       }
 
     }
+    else if (term == action_label_mark())
+    {
+      process::timed_multi_action action;
+      stream >> action;
+
+      const action_label_lts lts_action(lps::multi_action(action.actions(),action.time()));
+      auto [index, inserted] = multi_actions.insert(lts_action);
+      block_action_labels.push_back(index);
+
+      if (inserted)
+      {
+        std::size_t actual_index = lts.add_action(lts_action);
+        utilities::mcrl2_unused(actual_index);
+        assert(actual_index == index);
+      }
+    }
+    else if (term == transition_block_mark())
+    {
+      std::size_t remaining = read_index(stream);
+      std::size_t from = 0;
+      while (remaining > 0)
+      {
+        from = decode_difference(from, read_index(stream));
+        const std::size_t number_of_outgoing_transitions = read_index(stream);
+        if (number_of_outgoing_transitions == 0 || number_of_outgoing_transitions > remaining)
+        {
+          throw mcrl2::runtime_error("Corrupt transition block in labelled transition system (LTS) stream.");
+        }
+        remaining -= number_of_outgoing_transitions;
+
+        for (std::size_t i = 0; i < number_of_outgoing_transitions; ++i)
+        {
+          const std::size_t label = read_index(stream);
+          const std::size_t to = decode_difference(from, read_index(stream));
+          if (label >= block_action_labels.size())
+          {
+            throw mcrl2::runtime_error("Transition block refers to an undefined action label in labelled transition system (LTS) stream.");
+          }
+
+          std::size_t target_index = to;
+          if constexpr (std::is_same<LTS, probabilistic_lts_lts_t>::value)
+          {
+            target_index = lts.add_probabilistic_state(probabilistic_lts_lts_t::probabilistic_state_t(to));
+          }
+
+          lts.add_transition(transition(from, block_action_labels[label], target_index));
+          number_of_states = std::max(number_of_states, std::max(from + 1, to + 1));
+        }
+      }
+    }
     else if(term == probabilistic_transition_mark())
     {
       if constexpr (std::is_same<LTS, probabilistic_lts_lts_t>::value)
@@ -316,18 +404,35 @@ static void write_lts(atermpp::aterm_ostream& stream, const LTS& lts)
    lts.process_parameters(),
    lts.action_label_declarations());
 
-  for (auto& trans : lts.get_transitions())
+  if constexpr (std::is_same<LTS, probabilistic_lts_lts_t>::value)
   {
-    lts_lts_t::action_label_t label = lts.action_label(lts.apply_hidden_label_map(trans.label()));
-
-    if constexpr (std::is_same<LTS, probabilistic_lts_lts_t>::value)
+    for (auto& trans : lts.get_transitions())
     {
+      lts_lts_t::action_label_t label = lts.action_label(lts.apply_hidden_label_map(trans.label()));
       write_transition(stream, trans.from(), process::timed_multi_action(label.actions(), label.time()), lts.probabilistic_state(trans.to()));
     }
-    else
+  }
+  else
+  {
+    // The action labels are written in the order of their indices, such that the transition blocks can refer to them.
+    for (std::size_t i = 0; i < lts.num_action_labels(); ++i)
     {
-      write_transition(stream, trans.from(), process::timed_multi_action(label.actions(), label.time()), trans.to());
+      const lts_lts_t::action_label_t& label = lts.action_label(i);
+      write_action_label(stream, process::timed_multi_action(label.actions(), label.time()));
+    }
+
+    std::vector<transition> block;
+    block.reserve(transition_block_size);
+    for (const transition& trans : lts.get_transitions())
+    {
+      block.emplace_back(trans.from(), lts.apply_hidden_label_map(trans.label()), trans.to());
+      if (block.size() == transition_block_size)
+      {
+        write_transition_block(stream, block);
+        block.clear();
+      }
     }
+    write_transition_block(stream, block);
   }
 
   if (lts.has_state_info())
@@ -439,6 +544,39 @@ void write_transition(atermpp::aterm_ostream& stream, std::size_t from, const pr
   }
 }
 
+void write_action_label(atermpp::aterm_ostream& stream, const process::timed_multi_action& label)
+{
+  stream << detail::action_label_mark();
+  stream << label;
+}
+
+void write_transition_block(atermpp::aterm_ostream& stream, const std::vector<transition>& transitions)
+{
+  if (transitions.empty())
+  {
+    return;
+  }
+
+  stream << detail::transition_block_mark();
+  stream << atermpp::aterm_int(transitions.size());
+
+  std::size_t from = 0;
+  for (auto i = transitions.begin(); i != transitions.end(); )
+  {
+    // Determine the consecutive transitions with the same source state.
+    auto end = std::find_if(i, transitions.end(), [&](const transition& t) { return t.from() != i->from(); });
+
+    stream << atermpp::aterm_int(detail::encode_difference(from, i->from()));
+    stream << atermpp::aterm_int(std::distance(i, end));
+    from = i->from();
+    for (; i != end; ++i)
+    {
+      stream << atermpp::aterm_int(i->label());
+      stream << atermpp::aterm_int(detail::encode_difference(from, i->to()));
+    }
+  }
+}
+
 void write_state_label(atermpp::aterm_ostream& stream, const state_label_lts& label)
 {
   // During reading we assume that state labels are the only aterm_list.
@@ -13,6 +13,7 @@
 #include <boost/test/included/unit_test_framework.hpp>
 
 #include "mcrl2/lts/lts_algorithm.h"
+#include "mcrl2/lts/lts_io.h"
 
 using namespace mcrl2;
 
@@ -824,6 +825,92 @@ static void regression_delete_old_bb_slice()
   test_lts("regression test for GJKW bug (branching bisimulation signature [Blom/Orzan 2003])",l,expected_label_count, expected_state_count, expected_transition_count);
 }
 
+// Check that the parallel scc partitioner yields the same tau loops as the sequential one
+// on a pseudo randomly generated transition system.
+static void test_parallel_scc()
+{
+  const std::size_t number_of_states = 5000;
+  const std::size_t number_of_transitions = 7000;
+  std::string aut = "des(0," + std::to_string(number_of_transitions) + "," + std::to_string(number_of_states) + ")\n";
+  std::size_t random = 12345;
+  for (std::size_t i = 0; i < number_of_transitions; ++i)
+  {
+    random = (random * 1103515245 + 12345) % 2147483648;
+    const std::size_t from = random % number_of_states;
+    random = (random * 1103515245 + 12345) % 2147483648;
+    const std::size_t to = random % number_of_states;
+    aut += "(" + std::to_string(from) + "," + (i % 5 == 0 ? "a" : "tau") + "," + std::to_string(to) + ")\n";
+  }
+
+  std::istringstream is(aut);
+  lts::lts_aut_t l;
+  l.load(is);
+
+  lts::detail::scc_partitioner<lts::lts_aut_t> sequential(l, 1);
+  for (std::size_t number_of_threads: { 2, 4 })
+  {
+    lts::detail::scc_partitioner<lts::lts_aut_t> parallel(l, number_of_threads);
+    BOOST_CHECK_EQUAL(sequential.num_eq_classes(), parallel.num_eq_classes());
+
+    // The numbering of the classes may differ, but the partitions must be the same.
+    std::vector<std::size_t> parallel_class_of(sequential.num_eq_classes(), number_of_states);
+    for (std::size_t s = 0; s < number_of_states; ++s)
+    {
+      std::size_t& c = parallel_class_of[sequential.get_eq_class(s)];
+      if (c == number_of_states)
+      {
+        c = parallel.get_eq_class(s);
+      }
+      BOOST_CHECK_EQUAL(c, parallel.get_eq_class(s));
+    }
+  }
+
+  lts::lts_aut_t l_parallel = l;
+  lts::scc_reduce(l, false, 1);
+  lts::scc_reduce(l_parallel, false, 3);
+  test_lts("parallel scc reduction", l_parallel, l.num_action_labels(), l.num_states(), l.num_transitions());
+}
+
+// Check that an .lts file, in which the transitions are stored in compact blocks, is read back correctly.
+static void test_lts_transition_blocks()
+{
+  lts::lts_lts_t l;
+  const process::action_label a("a", data::sort_expression_list());
+  const process::action_label b("b", data::sort_expression_list());
+  l.add_action(lts::action_label_lts(lps::multi_action(process::action(a, data::data_expression_list()))));
+  l.add_action(lts::action_label_lts(lps::multi_action(process::action(b, data::data_expression_list()))));
+
+  const std::size_t number_of_states = 1000;
+  for (std::size_t s = 0; s < number_of_states; ++s)
+  {
+    l.add_state();
+    l.add_transition(lts::transition(s, 1, (s + 1) % number_of_states));
+    l.add_transition(lts::transition(s, 2, (s * 7) % number_of_states));
+    l.add_transition(lts::transition(number_of_states - s - 1, 0, s / 2));
+  }
+  l.set_initial_state(3);
+
+  std::stringstream stream;
+  {
+    atermpp::binary_aterm_ostream(stream) << l;
+  }
+  lts::lts_lts_t l_read;
+  atermpp::binary_aterm_istream(stream) >> l_read;
+
+  BOOST_CHECK_EQUAL(l_read.num_states(), l.num_states());
+  BOOST_CHECK_EQUAL(l_read.num_action_labels(), l.num_action_labels());
+  BOOST_CHECK_EQUAL(l_read.initial_state(), l.initial_state());
+  BOOST_REQUIRE_EQUAL(l_read.num_transitions(), l.num_transitions());
+  for (std::size_t i = 0; i < l.num_transitions(); ++i)
+  {
+    const lts::transition& t = l.get_transitions()[i];
+    const lts::transition& t_read = l_read.get_transitions()[i];
+    BOOST_CHECK_EQUAL(t.from(), t_read.from());
+    BOOST_CHECK_EQUAL(t.to(), t_read.to());
+    BOOST_CHECK_EQUAL(l.action_label(t.label()), l_read.action_label(t_read.label()));
+  }
+}
+
 void is_deterministic_test1()
 {
   std::string automaton =
@@ -869,5 +956,7 @@ BOOST_AUTO_TEST_CASE(test_main)
   counterexample_jk_1(3);
   counterexample_postprocessing();
   regression_delete_old_bb_slice();
+  test_parallel_scc();
+  test_lts_transition_blocks();
   // TODO: Add groote wijs branching bisimulation and add weak bisimulation tests. For the last Peterson is a good candidate.
 }
@@ -64,3 +64,33 @@ BOOST_AUTO_TEST_CASE(cumulative_tests)
        "34985431223981954640133634673587613874569183765329875682716348576138476108576387546187658127653201876510287356021876530287165023817650187635081237650812376501876350871236501287365012873650182735610237560000000000000000000000000320129384710938471039561390847109398734601956601293846019285609853607349587453098713409835719348571930857");
 }
 
+
+BOOST_AUTO_TEST_CASE(small_and_big_fractions)
+{
+  const probabilistic_arbitrary_precision_fraction third("1","3");
+  const probabilistic_arbitrary_precision_fraction sixth("1","6");
+  const probabilistic_arbitrary_precision_fraction half("1","2");
+  BOOST_CHECK(half.is_small());
+  BOOST_CHECK(third+sixth==half);
+  BOOST_CHECK(half-sixth==third);
+  BOOST_CHECK(pp(third+sixth)=="1/2");
+  BOOST_CHECK(std::hash<probabilistic_arbitrary_precision_fraction>()(third+sixth)==
+              std::hash<probabilistic_arbitrary_precision_fraction>()(half));
+
+  // The denominator of the product of x and y does not fit in 64 bits.
+  const probabilistic_arbitrary_precision_fraction x("1","4294967311");
+  const probabilistic_arbitrary_precision_fraction y("2","4294967357");
+  const probabilistic_arbitrary_precision_fraction xy=x*y;
+  BOOST_CHECK(!xy.is_small());
+  BOOST_CHECK(pp(xy)=="2/18446744400127067027");
+  BOOST_CHECK(xy<x);
+  BOOST_CHECK(xy+xy>xy);
+
+  // Dividing by y again yields a small fraction.
+  const probabilistic_arbitrary_precision_fraction z=xy/y;
+  BOOST_CHECK(z.is_small());
+  BOOST_CHECK(z==x);
+  BOOST_CHECK(pp(z)=="1/4294967311");
+  BOOST_CHECK(std::hash<probabilistic_arbitrary_precision_fraction>()(z)==
+              std::hash<probabilistic_arbitrary_precision_fraction>()(x));
+}
@@ -37,11 +37,18 @@ class global_reset_variables_algorithm: public stategraph_global_algorithm
     // if true, the resulting PBES is simplified
     bool m_simplify;
 
+    // the default values of sorts that have been computed
+    std::map<data::sort_expression, data::data_expression> m_default_values;
+
     data::data_expression default_value(const data::sort_expression& x)
     {
-      // TODO: make this an attribute
-      data::representative_generator f(m_pbes.data());
-      return f(x);
+      auto i = m_default_values.find(x);
+      if (i == m_default_values.end())
+      {
+        data::representative_generator f(m_pbes.data());
+        i = m_default_values.emplace(x, f(x)).first;
+      }
+      return i->second;
     }
 
     // returns the parameters of the propositional variable with name X
@@ -268,10 +268,12 @@ class local_control_flow_graph_vertex: public LCFP_vertex, public add_edges<loca
       return out.str();
     }
 
-    void set_marking_update(std::size_t i, const data::variable& d, const std::set<data::variable>& V) const
+    const std::set<data::variable>& set_marking_update(std::size_t i, const data::variable& d, std::set<data::variable> V) const
     {
       std::pair<std::size_t, data::variable> p(i, d);
-      m_marking_update[p] = V;
+      auto& result = m_marking_update[p];
+      result = std::move(V);
+      return result;
     }
 
     const std::map<std::pair<std::size_t, data::variable>, std::set<data::variable> >& marking_update() const
@@ -127,6 +127,9 @@ class stategraph_local_algorithm: public stategraph_algorithm
 
     std::size_t m_marking_rewrite_cached_count;
 
+    // the result of marking_update if marking updates are not cached
+    std::set<data::variable> m_marking_update;
+
     std::vector<core::identifier_string> binding_variable_names() const
     {
       std::vector<core::identifier_string> result;
@@ -278,19 +281,21 @@ class stategraph_local_algorithm: public stategraph_algorithm
         auto const& predvars = eq_X.predicate_variables();
         for (std::size_t i = 0; i < predvars.size(); i++)
         {
+          if (rules(X, i))
+          {
+            continue;
+          }
           auto const& Ye = predvars[i];
-          for (auto j = belongs.begin(); j != belongs.end(); )
+          // remove the parameters that are used or changed by Ye
+          for (const std::set<std::size_t>* M: { &Ye.used(), &Ye.changed() })
           {
-            std::size_t m = *j;
-            if ((contains(Ye.used(), m) || contains(Ye.changed(), m)) && !rules(X, i))
+            for (std::size_t m: *M)
             {
-              mCRL2log(log::debug1, "stategraph") << " remove (X, i, m) = (" << X << ", " << i << ", " << m << ") variable=" << eq_X.parameters()[m] << " from belongs " << std::endl;
-              mCRL2log(log::debug2, "stategraph") << "  used = " << print_parameters(Ye.name(), Ye.used()) << " changed = " << print_parameters(Ye.name(), Ye.changed()) << std::endl;
-              belongs.erase(j++);
-            }
-            else
-            {
-              ++j;
+              if (belongs.erase(m) > 0)
+              {
+                mCRL2log(log::debug1, "stategraph") << " remove (X, i, m) = (" << X << ", " << i << ", " << m << ") variable=" << eq_X.parameters()[m] << " from belongs " << std::endl;
+                mCRL2log(log::debug2, "stategraph") << "  used = " << print_parameters(Ye.name(), Ye.used()) << " changed = " << print_parameters(Ye.name(), Ye.changed()) << std::endl;
+              }
             }
           }
         }
@@ -399,12 +404,12 @@ class stategraph_local_algorithm: public stategraph_algorithm
       return m_datar(x, sigma);
     }
 
-    std::set<data::variable> marking_update(const local_control_flow_graph_vertex& u,
-                                            std::size_t i,
-                                            const data::variable& d,
-                                            const data::data_expression_list& e,
-                                            const stategraph_equation& eq_Y,
-                                            const belongs_relation& B)
+    const std::set<data::variable>& marking_update(const local_control_flow_graph_vertex& u,
+                                                   std::size_t i,
+                                                   const data::variable& d,
+                                                   const data::data_expression_list& e,
+                                                   const stategraph_equation& eq_Y,
+                                                   const belongs_relation& B)
     {
       if (m_cache_marking_updates)
       {
@@ -427,12 +432,13 @@ class stategraph_local_algorithm: public stategraph_algorithm
       sigma[u.variable()] = u.value();
       auto W = FV(rewr(nth_element(e, l), sigma));
       std::set<data::variable> V = belongs_intersection(W, B, X);
+      m_marking_rewrite_count++;
       if (m_cache_marking_updates)
       {
-        u.set_marking_update(i, d, V);
+        return u.set_marking_update(i, d, std::move(V));
       }
-      m_marking_rewrite_count++;
-      return V;
+      m_marking_update = std::move(V);
+      return m_marking_update;
     }
 
     void print_marking_statistics()
@@ -456,15 +462,23 @@ class stategraph_local_algorithm: public stategraph_algorithm
       auto const& eq_Y = *find_equation(m_pbes, Y);
       auto const& Ye = eq_X.predicate_variables()[i];
       auto const& e = Ye.parameters();
-      auto m = v.marking(); // N.B. a copy must be made, to handle the case u == v properly
+      // N.B. a copy must be made to handle the case u == v properly, since u.marking is extended below
+      std::set<data::variable> v_marking;
+      const std::set<data::variable>& m = (&u == &v) ? (v_marking = v.marking()) : v.marking();
       for (const data::variable& d: m)
       {
         if (check_belongs && belongs_contains(B, Y, d))
         {
           continue;
         }
-        auto const update = marking_update(u, i, d, e, eq_Y, B);
-        u.extend_marking(update);
+        if (m_cache_marking_updates && u.marking_update().find(std::make_pair(i, d)) != u.marking_update().end())
+        {
+          // a cached update has already been added to u.marking, since markings only grow
+          m_marking_rewrite_count++;
+          m_marking_rewrite_cached_count++;
+          continue;
+        }
+        u.extend_marking(marking_update(u, i, d, e, eq_Y, B));
       }
       return u.marking().size() != size;
     }
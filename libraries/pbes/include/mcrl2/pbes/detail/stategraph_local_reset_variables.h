@@ -55,6 +55,9 @@ class local_reset_variables_algorithm: public stategraph_local_algorithm
     // m_occurring_data_parameters[X] contains the indices of data parameters that occur in at least one local control flow graph
     std::map<core::identifier_string, std::set<std::size_t> > m_occurring_data_parameters;
 
+    // the default values of sorts that have been computed
+    std::map<data::sort_expression, data::data_expression> m_default_values;
+
     // returns a default value for the given sort, that corresponds to parameter d_X[j]
     data::data_expression default_value(const core::identifier_string& X, std::size_t j, const data::sort_expression& x)
     {
@@ -64,9 +67,13 @@ class local_reset_variables_algorithm: public stategraph_local_algorithm
         return nth_element(Xinit.parameters(), j);
       }
 
-      // TODO: make this an attribute
-      data::representative_generator f(m_pbes.data());
-      return f(x);
+      auto i = m_default_values.find(x);
+      if (i == m_default_values.end())
+      {
+        data::representative_generator f(m_pbes.data());
+        i = m_default_values.emplace(x, f(x)).first;
+      }
+      return i->second;
     }
 
     void compute_occurring_data_parameters()
@@ -282,70 +289,92 @@ data::data_expression_list local_reset_variables_algorithm::reset_variable_param
   assert(d_Y.size() == Ye.parameters().size());
   const std::size_t J = m_local_control_flow_graphs.size();
 
+  // The vertices of the local control flow graphs that determine whether a parameter of Y is relevant
+  // do not depend on that parameter, so they are looked up once.
+  struct graph_vertices
+  {
+    std::size_t j;
+    std::size_t p;
+    const local_control_flow_graph_vertex* u; // u = (Y, p, target(X, i, p)) or u = (Y, p), or nullptr if it has a variable
+    std::vector<const local_control_flow_graph_vertex*> W; // W = { w | w = (Y, p, d_Y[p]=r) }
+  };
+  std::vector<graph_vertices> vertices;
+  for (std::size_t j = 0; j < J; j++)
+  {
+    auto const& Vj = m_local_control_flow_graphs[j];
+    default_rules_predicate rules(Vj);
+    if (rules(X, i))
+    {
+      auto const& v = Vj.find_vertex(Y); // v = (Y, p, q)
+      std::size_t p = v.index();
+      graph_vertices Gj{j, p, nullptr, {}};
+      auto di = Ye.target().find(p);
+      if (di != Ye.target().end())
+      {
+        auto const& q1 = di->second; // q1 = target(X, i, p)
+        Gj.u = &Vj.find_vertex(local_control_flow_graph_vertex(Y, p, data::undefined_variable(), q1));
+      }
+      else if(!v.has_variable())
+      {
+        Gj.u = &v;
+      }
+      else
+      {
+        for (const auto& w: Vj.vertices)
+        {
+          if (w.name() == Y && w.index() == p)
+          {
+            Gj.W.push_back(&w);
+          }
+        }
+      }
+      vertices.push_back(std::move(Gj));
+    }
+  }
+
   auto const& dp_Y = eq_Y.data_parameter_indices();
   for (std::size_t k: dp_Y)
   {
     bool relevant = true;
     std::set<data::data_expression> condition;
-    for (std::size_t j = 0; j < J; j++)
+    for (const graph_vertices& Gj: vertices)
     {
-      auto const& Vj = m_local_control_flow_graphs[j];
-      auto& Bj = m_belongs[j];
-      default_rules_predicate rules(Vj);
-      if (rules(X, i))
+      if (!contains(m_belongs[Gj.j][Y], d_Y[k]))
+      {
+        continue;
+      }
+      if (Gj.u != nullptr)
       {
-        auto const& v = Vj.find_vertex(Y); // v = (Y, p, q)
-        std::size_t p = v.index();
-        auto di = Ye.target().find(p);
-        if (di != Ye.target().end())
+        if (!contains(Gj.u->marking(), d_Y[k]))
         {
-          auto const& q1 = di->second; // q1 = target(X, i, p)
-          auto const& u = Vj.find_vertex(local_control_flow_graph_vertex(Y, p, data::undefined_variable(), q1));
-          if (contains(Bj[Y], d_Y[k]) && !contains(u.marking(), d_Y[k]))
-          {
-            relevant = false;
-            break;
-          }
+          relevant = false;
+          break;
         }
-        else if(!v.has_variable())
+      }
+      else
+      {
+        // update relevant and condition
+        bool found = false;
+        for (const local_control_flow_graph_vertex* w: Gj.W)
         {
-          if (contains(Bj[Y], d_Y[k]) && !contains(v.marking(), d_Y[k]))
+          if (contains(w->marking(), d_Y[k]))
           {
-            relevant = false;
-            break;
+            found = true;
           }
-        }
-        else
-        {
-          // update relevant and condition
-          if (contains(Bj[Y], d_Y[k]))
+          else
           {
-            bool found = false;
-            for (const auto& w: Vj.vertices)
+            if  (w->has_variable())
             {
-              if (w.name() == Y && w.index() == p)  // w = (Y, p, d_Y[p]=r)
-              {
-                if (contains(w.marking(), d_Y[k]))
-                {
-                  found = true;
-                }
-                else
-                {
-                  if  (w.has_variable())
-                  {
-                    auto const& r = w.value();
-                    condition.insert(data::equal_to(nth_element(e, p), r));
-                  }
-                }
-              }
-            }
-            if (!found)
-            {
-              relevant = false;
-              break;
+              auto const& r = w->value();
+              condition.insert(data::equal_to(nth_element(e, Gj.p), r));
             }
           }
         }
+        if (!found)
+        {
+          relevant = false;
+          break;
+        }
       }
     }
     if (!relevant)
@@ -489,6 +489,7 @@ class stategraph_pbes
     std::vector<stategraph_equation> m_equations;
     std::set<data::variable> m_global_variables;
     propositional_variable_instantiation m_initial_state;
+    std::map<core::identifier_string, std::size_t> m_equation_index; // maps the name of an equation to its position
 
   public:
     stategraph_pbes() = default;
@@ -501,10 +502,18 @@ class stategraph_pbes
       const std::vector<pbes_equation>& equations = p.equations();
       for (const pbes_equation& equation: equations)
       {
+        m_equation_index[equation.variable().name()] = m_equations.size();
         m_equations.emplace_back(equation, rewr);
       }
     }
 
+    /// \brief Returns the position of the equation with name X, or the number of equations if there is none.
+    std::size_t equation_index(const core::identifier_string& X) const
+    {
+      auto i = m_equation_index.find(X);
+      return i == m_equation_index.end() ? m_equations.size() : i->second;
+    }
+
     const std::vector<stategraph_equation>& equations() const
     {
       return m_equations;
@@ -576,12 +585,10 @@ inline
 std::vector<stategraph_equation>::const_iterator find_equation(const stategraph_pbes& p, const core::identifier_string& X, bool warn = true)
 {
   auto const& equations = p.equations();
-  for (auto i = equations.begin(); i != equations.end(); ++i)
+  std::size_t index = p.equation_index(X);
+  if (index < equations.size())
   {
-    if (i->variable().name() == X)
-    {
-      return i;
-    }
+    return equations.begin() + index;
   }
   if (warn)
   {
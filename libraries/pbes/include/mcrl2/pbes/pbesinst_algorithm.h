@@ -17,6 +17,9 @@
 #include "mcrl2/pbes/rewriters/enumerate_quantifiers_rewriter.h"
 #include "mcrl2/pbes/rewriters/one_point_rule_rewriter.h"
 #include "mcrl2/pbes/rewriters/simplify_quantifiers_rewriter.h"
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace mcrl2
 {
@@ -109,11 +112,14 @@ class pbesinst_algorithm
     /// \brief The number of generated equations.
     std::size_t m_equation_count;
 
-    /// \brief Propositional variable instantiations that need to be handled.
-    std::set<propositional_variable_instantiation> todo;
+    /// \brief Propositional variable instantiations that need to be handled, in the order in which they are found.
+    std::deque<propositional_variable_instantiation> todo;
 
-    /// \brief Propositional variable instantiations that have been handled.
-    std::set<propositional_variable_instantiation> done;
+    /// \brief Propositional variable instantiations that have been handled or are in todo.
+    std::unordered_set<propositional_variable_instantiation> discovered;
+
+    /// \brief The names of the propositional variable instantiations that have been renamed.
+    std::unordered_map<propositional_variable_instantiation, propositional_variable_instantiation> m_renamings;
 
     /// \brief Data structure for storing the result. E[i] corresponds to the equations
     /// generated from the i-th PBES equation.
@@ -140,10 +146,33 @@ class pbesinst_algorithm
       return "";
     }
 
+    /// \brief Renames the propositional variable instantiation X_e. Since pbesinst_rename
+    /// pretty prints the parameters, the result is stored for later occurrences of X_e.
+    const propositional_variable_instantiation& rename(const propositional_variable_instantiation& X_e)
+    {
+      auto i = m_renamings.find(X_e);
+      if (i == m_renamings.end())
+      {
+        i = m_renamings.emplace(X_e, pbesinst_rename()(X_e)).first;
+      }
+      return i->second;
+    }
+
     // renames propositional variables in x
-    pbes_expression rho(const pbes_expression& x) const
+    pbes_expression rho(const pbes_expression& x)
     {
-      return replace_propositional_variables(x, pbesinst_rename());
+      return replace_propositional_variables(x, [&](const propositional_variable_instantiation& X_e) { return rename(X_e); });
+    }
+
+    /// \brief Is called for every generated equation X_e = psi_e, where index is the index of the
+    /// PBES equation of X_e. By default the equation is renamed and stored in the result.
+    virtual void on_report_equation(const propositional_variable_instantiation& X_e,
+                                    const pbes_expression& psi_e,
+                                    const fixpoint_symbol& symbol,
+                                    std::size_t index
+                                   )
+    {
+      E[index].emplace_back(symbol, propositional_variable(rename(X_e).name(), data::variable_list()), rho(psi_e));
     }
 
   public:
@@ -163,13 +192,12 @@ class pbesinst_algorithm
         m_print_equations(print_equations)
     {}
 
+    virtual ~pbesinst_algorithm() = default;
+
     /// \brief Runs the algorithm. The result is obtained by calling the function \p get_result.
     /// \param p A PBES.
     void run(pbes& p)
     {
-      using utilities::detail::pick_element;
-      using utilities::detail::contains;
-
       pbes_system::detail::instantiate_global_variables(p);
 
       // simplify all right hand sides of p
@@ -195,11 +223,12 @@ class pbesinst_algorithm
         E.emplace_back();
       }
       init = atermpp::down_cast<propositional_variable_instantiation>(R(p.initial_state()));
-      todo.insert(init);
+      todo.push_back(init);
+      discovered.insert(init);
       while (!todo.empty())
       {
-      	auto const& X_e = pick_element(todo);
-        done.insert(X_e);
+        const propositional_variable_instantiation X_e = todo.front();
+        todo.pop_front();
         int index = equation_index[X_e.name()];
         const pbes_equation& eqn = p.equations()[index];
         data::rewriter::substitution_type sigma;
@@ -207,19 +236,22 @@ class pbesinst_algorithm
         auto const& phi = eqn.formula();
         pbes_expression psi_e = R(phi, sigma);
         R.clear_identifier_generator();
-        for (const propositional_variable_instantiation& v: find_propositional_variable_instantiations(psi_e))
+        // The occurrences are visited in the order of psi_e, so that the order of the equations
+        // does not depend on the addresses of the terms.
+        std::vector<propositional_variable_instantiation> occurrences;
+        find_propositional_variable_instantiations(psi_e, std::back_inserter(occurrences));
+        for (const propositional_variable_instantiation& v: occurrences)
         {
-          if (!contains(done, v))
+          if (discovered.insert(v).second)
           {
-            todo.insert(v);
+            todo.push_back(v);
           }
         }
-        pbes_equation new_eqn(eqn.symbol(), propositional_variable(pbesinst_rename()(X_e).name(), data::variable_list()), rho(psi_e));
         if (m_print_equations)
         {
           mCRL2log(log::info) << eqn.symbol() << " " << X_e << " = " << psi_e << std::endl;
         }
-        E[index].push_back(new_eqn);
+        on_report_equation(X_e, psi_e, eqn.symbol(), index);
         mCRL2log(log::verbose) << print_equation_count(++m_equation_count);
         detail::check_bes_equation_limit(m_equation_count);
       }
@@ -234,7 +266,7 @@ class pbesinst_algorithm
       {
         result.equations().insert(result.equations().end(), equations.begin(), equations.end());
       }
-      result.initial_state() = pbesinst_rename()(init);
+      result.initial_state() = rename(init);
       return result;
     }
 
@@ -16,6 +16,8 @@
 #include "mcrl2/pbes/pbesinst_find_loops.h"
 #include "mcrl2/pbes/pbesinst_partial_solve.h"
 #include "mcrl2/pbes/pbesinst_structure_graph.h"
+#include <algorithm>
+#include <deque>
 
 namespace mcrl2 {
 
@@ -71,7 +73,7 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
   protected:
     std::array<vertex_set, 2> S;
     std::array<strategy_vector, 2> tau;
-    std::array<detail::computation_guard, 2> S_guard;
+    std::deque<structure_graph::index_type> attractor_todo; // used by extend_attractor
 
     pbes_expression b; // to store the result of the Rplus computation
     detail::computation_guard find_loops_guard;
@@ -331,6 +333,59 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
       return f.top();
     }
 
+    // Extends S[alpha] with the vertices that are attracted to it after the equation of vertex u has been
+    // added to the structure graph, together with the new vertices first, first + 1, ...
+    // N.B. Only u, the new vertices and the predecessors of vertices that are added to S[alpha] are inspected.
+    // Since the other vertices did not get new successors, S[alpha] remains an attractor set of the part of
+    // the structure graph that has been explored, without recomputing it for the whole graph.
+    void extend_attractor(structure_graph::index_type u, structure_graph::index_type first, std::size_t alpha)
+    {
+      simple_structure_graph G(m_graph_builder.vertices());
+      global_local_strategy<simple_structure_graph> tau_alpha(G, tau, alpha);
+      vertex_set& A = S[alpha];
+
+      attractor_todo.clear();
+      if (A.contains(u))
+      {
+        attractor_todo.insert(attractor_todo.end(), G.predecessors(u).begin(), G.predecessors(u).end());
+      }
+      else
+      {
+        attractor_todo.push_back(u);
+      }
+      for (structure_graph::index_type v = m_graph_builder.extent(); v-- > first; )
+      {
+        attractor_todo.push_back(v);
+      }
+
+      while (!attractor_todo.empty())
+      {
+        // N.B. Use a breadth first search, to minimize counter examples
+        structure_graph::index_type v = attractor_todo.front();
+        attractor_todo.pop_front();
+        const auto& successors = G.successors(v);
+        if (A.contains(v) || successors.empty())
+        {
+          continue;
+        }
+        bool attracted = G.decoration(v) == alpha
+                         ? std::any_of(successors.begin(), successors.end(), [&](structure_graph::index_type w) { return A.contains(w); })
+                         : includes_successors(G, v, A);
+        if (attracted)
+        {
+          tau_alpha.set_strategy(v, find_successor_in(G, v, A));
+          A.insert(v);
+          for (structure_graph::index_type w: G.predecessors(v))
+          {
+            if (!A.contains(w))
+            {
+              attractor_todo.push_back(w);
+            }
+          }
+        }
+      }
+    }
+
     bool solution_found(const propositional_variable_instantiation& init) const override
     {
       auto u = m_graph_builder.find_vertex(init);
@@ -489,6 +544,7 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
 
     void on_report_equation(const propositional_variable_instantiation& X, const pbes_expression& psi, std::size_t k) override
     {
+      auto first = static_cast<structure_graph::index_type>(m_graph_builder.extent());
       super::on_report_equation(X, psi, k);
 
       // The structure graph has just been extended, so S[0] and S[1] need to be resized.
@@ -504,27 +560,20 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
       {
         S[1].insert(u);
       }
+
+      // Optimization 3 is implemented by maintaining S[0] and S[1] as attractor sets.
+      if (m_options.optimization >= 3)
+      {
+        extend_attractor(u, first, 0);
+        extend_attractor(u, first, 1);
+      }
     }
 
     void on_discovered_elements(const std::set<propositional_variable_instantiation>& elements) override
     {
       using utilities::detail::contains;
 
-      if (m_options.optimization == 3)
-      {
-        if (S_guard[0](S[0].size()))
-        {
-          simple_structure_graph G(m_graph_builder.vertices());
-          S[0] = attr_default_with_tau(G, S[0], 0, tau);
-        }
-        if (S_guard[1](S[1].size()))
-        {
-          simple_structure_graph G(m_graph_builder.vertices());
-          S[1] = attr_default_with_tau(G, S[1], 1, tau);
-        }
-        assert(strategies_are_set_in_solved_nodes());
-      }
-      else if (m_options.optimization == 4 && (m_options.aggressive || find_loops_guard(m_iteration_count)))
+      if (m_options.optimization == 4 && (m_options.aggressive || find_loops_guard(m_iteration_count)))
       {
         simple_structure_graph G(m_graph_builder.vertices());
         detail::find_loops2(G, S, tau, m_iteration_count); // modifies S[0] and S[1]
@@ -16,6 +16,7 @@
 #include "mcrl2/lts/lts_algorithm.h"
 #include "mcrl2/pbes/pbes_equation_index.h"
 #include "mcrl2/pbes/pbessolve_attractors.h"
+#include "mcrl2/utilities/metrics.h"
 
 namespace mcrl2 {
 
@@ -78,6 +79,10 @@ class solve_structure_graph_algorithm
 
     bool use_toms_optimization = false;
 
+    // counts the calls of solve_recursive, or nullptr if no metrics are collected
+    utilities::metric_counter* m_recursive_calls_metric =
+      utilities::metrics().enabled() ? &utilities::metrics().counter("pbes.solve_recursive_calls") : nullptr;
+
     // find a successor of u
     static structure_graph::index_type succ(const structure_graph& G, structure_graph::index_type u)
     {
@@ -125,6 +130,10 @@ class solve_structure_graph_algorithm
     std::pair<vertex_set, vertex_set> solve_recursive(structure_graph& G)
     {
       mCRL2log(log::debug) << "\n  --- solve_recursive input ---\n" << G << std::endl;
+      if (m_recursive_calls_metric != nullptr)
+      {
+        m_recursive_calls_metric->add();
+      }
       std::size_t N = G.extent();
 
       if (G.is_empty())
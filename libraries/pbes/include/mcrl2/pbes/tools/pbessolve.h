@@ -78,7 +78,7 @@ class pbessolve_tool: public rewriter_tool<pbes_input_tool<input_tool>>
                         .add_value_desc(2, "Detect winning loops.")
                         .add_value_desc(3, "Solve subgames using a fatal attractor.")
                         .add_value_desc(4, "Solve subgames using the solver.")
-        ,"Use solve strategy NAME. Strategies 1-4 periodically apply on-the-fly solving, which may lead to early termination.",
+        ,"Use solve strategy NAME. Strategies 1-4 apply on-the-fly solving, which may lead to early termination.",
                       's');
       desc.add_hidden_option("long-strategy",
                              utilities::make_enum_argument<int>("STRATEGY")
@@ -204,6 +204,10 @@ class pbessolve_tool: public rewriter_tool<pbes_input_tool<input_tool>>
       timer().finish("instantiation");
 
       mCRL2log(log::verbose) << "Number of vertices in the structure graph: " << G.all_vertices().size() << std::endl;
+      if (utilities::metrics().enabled())
+      {
+        utilities::metrics().set_gauge("pbes.structure_graph_vertices", G.all_vertices().size());
+      }
 
       if ((!lpsfile.empty() || !ltsfile.empty()) && !has_counter_example_information(pbesspec))
       {
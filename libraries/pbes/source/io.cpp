@@ -10,10 +10,12 @@
 #include "mcrl2/atermpp/aterm_io_binary.h"
 #include "mcrl2/core/load_aterm.h"
 #include "mcrl2/data/data_io.h"
+#include "mcrl2/data/detail/rewrite/jitty_strategy_store.h"
 #include "mcrl2/pbes/algorithms.h"
 #include "mcrl2/pbes/detail/pbes_io.h"
 #include "mcrl2/pbes/io.h"
 #include "mcrl2/pbes/parse.h"
+#include "mcrl2/utilities/mapped_file.h"
 
 namespace mcrl2
 {
@@ -51,7 +53,9 @@ void save_pbes(const pbes& pbes,
   mCRL2log(log::verbose) << "Saving result in " << format.shortname() << " format..." << std::endl;
   if (format == pbes_format_internal())
   {
-    atermpp::binary_aterm_ostream(stream) << pbes;
+    atermpp::binary_aterm_ostream output(stream);
+    output << pbes;
+    data::detail::write_rewriter_state(output);
   }
   else
   if (format == pbes_format_text())
@@ -79,7 +83,9 @@ void load_pbes(pbes& pbes, std::istream& stream, utilities::file_format format,
   mCRL2log(log::verbose) << "Loading PBES in " << format.shortname() << " format..." << std::endl;
   if (format == pbes_format_internal())
   {
-    atermpp::binary_aterm_istream(stream) >> pbes;
+    atermpp::binary_aterm_istream input(stream);
+    input >> pbes;
+    data::detail::read_rewriter_state(input);
   }
   else
   if (format == pbes_format_text())
@@ -150,11 +156,7 @@ void load_pbes(pbes& pbes,
   }
   else
   {
-    std::ifstream filestream(filename,(format.text_format()?std::ios_base::in: std::ios_base::binary));
-    if (!filestream.good())
-    {
-      throw mcrl2::runtime_error("Could not open file " + filename);
-    }
+    utilities::mapped_file_istream filestream(filename);
     load_pbes(pbes, filestream, format, core::detail::file_source(filename));
   }
 }
@@ -300,7 +302,7 @@ pbes load_pbes(const std::string& filename)
   }
   else
   {
-    std::ifstream from(filename, std::ifstream::in | std::ifstream::binary);
+    utilities::mapped_file_istream from(filename);
     atermpp::binary_aterm_istream(from) >> result;
   }
   return result;
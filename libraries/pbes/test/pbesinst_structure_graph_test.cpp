@@ -0,0 +1,98 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file pbesinst_structure_graph_test.cpp
+/// \brief Tests for the on-the-fly solving of pbesinst_structure_graph_algorithm2.
+
+#define BOOST_TEST_MODULE pbesinst_structure_graph_test
+#include <boost/test/included/unit_test_framework.hpp>
+
+#include "mcrl2/pbes/pbesinst_structure_graph2.h"
+#include "mcrl2/pbes/solve_structure_graph.h"
+#include "mcrl2/pbes/txt2pbes.h"
+
+using namespace mcrl2;
+using namespace mcrl2::pbes_system;
+
+// Counts the number of BES equations that are generated.
+class counting_structure_graph_algorithm: public pbesinst_structure_graph_algorithm2
+{
+  public:
+    typedef pbesinst_structure_graph_algorithm2 super;
+
+    std::size_t equation_count = 0;
+
+    counting_structure_graph_algorithm(const pbessolve_options& options, const pbes& p, structure_graph& G)
+      : super(options, p, G)
+    {}
+
+    void on_report_equation(const propositional_variable_instantiation& X, const pbes_expression& psi, std::size_t k) override
+    {
+      super::on_report_equation(X, psi, k);
+      equation_count++;
+    }
+};
+
+// Returns the solution of p and the number of generated BES equations.
+std::pair<bool, std::size_t> solve(const pbes& p, int optimization)
+{
+  pbessolve_options options;
+  options.optimization = optimization;
+  pbes q = p;
+  structure_graph G;
+  counting_structure_graph_algorithm algorithm(options, q, G);
+  algorithm.run();
+  return { solve_structure_graph(G), algorithm.equation_count };
+}
+
+// The value of X(0) follows from Y(3), which is found long before the bound 100 on n is reached.
+// An attractor that is kept up to date after every equation determines X(3), X(2), X(1) and X(0)
+// right after the equation of Y(3) has been generated.
+BOOST_AUTO_TEST_CASE(test_early_termination)
+{
+  std::string text =
+    "pbes mu X(n: Nat) = (val(n < 100) && X(n + 1)) || Y(n);\n"
+    "     nu Y(n: Nat) = val(n > 2);                         \n"
+    "init X(0);                                              \n"
+    ;
+  pbes p = txt2pbes(text);
+
+  auto [result2, count2] = solve(p, 2);
+  auto [result3, count3] = solve(p, 3);
+  BOOST_CHECK(result2);
+  BOOST_CHECK(result3);
+  BOOST_CHECK_GT(count2, 100u);
+  BOOST_CHECK_LT(count3, 20u);
+}
+
+// The on-the-fly solving must not change the solution.
+BOOST_AUTO_TEST_CASE(test_solutions)
+{
+  std::vector<std::string> texts = {
+    "pbes nu X(n: Nat) = (val(n < 10) && X(n + 1)) && Y(n);\n"
+    "     mu Y(n: Nat) = val(n != 7) || Y(n);              \n"
+    "init X(0);                                            \n"
+    ,
+    "pbes mu X(n: Nat) = (val(n < 10) && X(n + 1)) || Y(n) || X(n);\n"
+    "     nu Y(n: Nat) = val(n == 4) && Y(n);                      \n"
+    "init X(0);                                                    \n"
+    ,
+    "pbes nu X(b: Bool) = Y(b) && X(!b);     \n"
+    "     mu Y(b: Bool) = X(b) || val(b);    \n"
+    "init X(true);                           \n"
+  };
+  for (const std::string& text: texts)
+  {
+    pbes p = txt2pbes(text);
+    bool expected_result = solve(p, 2).first;
+    for (int optimization = 3; optimization <= 7; optimization++)
+    {
+      BOOST_CHECK_EQUAL(solve(p, optimization).first, expected_result);
+    }
+  }
+}
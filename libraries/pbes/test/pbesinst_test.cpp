@@ -260,6 +260,27 @@ BOOST_AUTO_TEST_CASE(test_abp_no_deadlock)
   BOOST_CHECK(is_bes(q));
 }
 
+// The equations are generated in the order in which their variables are found.
+BOOST_AUTO_TEST_CASE(test_pbesinst_order)
+{
+  std::string text =
+    "pbes nu X(n: Nat) = val(n < 3) => (X(n + 2) && X(n + 1)); \n"
+    "                                                          \n"
+    "init X(0);                                                \n"
+    ;
+  pbes p = txt2pbes(text);
+  pbes q = pbesinst_lazy(p);
+  BOOST_CHECK(is_bes(q));
+  std::vector<std::string> names;
+  for (const pbes_equation& eqn: q.equations())
+  {
+    names.push_back(eqn.variable().name());
+  }
+  std::vector<std::string> expected = { "X@0", "X@2", "X@1", "X@4", "X@3" };
+  BOOST_CHECK(names == expected);
+  BOOST_CHECK_EQUAL(pbes_system::pp(q), pbes_system::pp(pbesinst_lazy(p)));
+}
+
 // Example supplied by Tim Willemse, 23-05-2011
 BOOST_AUTO_TEST_CASE(test_functions)
 {
@@ -142,6 +142,18 @@ public:
     /*! Reset the graph based on the given edge structure. */
     void assign(edge_list edges, EdgeDirection edge_dir);
 
+    /*! Reset the graph to `out_degree.size()` vertices, where vertex v has
+        `out_degree[v]` successors. The successors are assigned by calling
+        `fill_successors(successors, successor_index)` once, which must write
+        the successors of each vertex v, in any order, to the positions
+        successor_index[v] to successor_index[v + 1] of `successors`.
+        Unlike assign(edges, edge_dir), this does not require a list of all
+        edges to be created and sorted first. */
+    template<class SuccessorFunction>
+    void assign( const std::vector<edgei> &out_degree,
+                 SuccessorFunction fill_successors,
+                 EdgeDirection edge_dir );
+
     /*! Convert the graph into a list of edges. */
     edge_list get_edges() const;
 
@@ -165,4 +165,62 @@ void StaticGraph::make_subgraph( const StaticGraph &graph,
     }
 }
 
+template<class SuccessorFunction>
+void StaticGraph::assign( const std::vector<edgei> &out_degree,
+                          SuccessorFunction fill_successors,
+                          EdgeDirection edge_dir )
+{
+    const verti V = (verti)out_degree.size();
+    edgei E = 0;
+    for (verti v = 0; v < V; ++v) E += out_degree[v];
+
+    /* Reallocate memory */
+    reset(V, E, edge_dir);
+
+    /* The successor lists are needed to create the predecessor lists, so they
+       are stored temporarily if the graph does not store successors. */
+    std::vector<edgei> index_buffer;
+    std::vector<verti> successor_buffer;
+    edgei *index = successor_index_;
+    verti *successors = successors_;
+    if (!(edge_dir_ & EDGE_SUCCESSOR))
+    {
+        index_buffer.resize(V + 1);
+        successor_buffer.resize(E);
+        index = index_buffer.data();
+        successors = successor_buffer.data();
+    }
+
+    /* Create successor index and successor lists */
+    index[0] = 0;
+    for (verti v = 0; v < V; ++v) index[v + 1] = index[v] + out_degree[v];
+    fill_successors(successors, static_cast<const edgei*>(index));
+    for (verti v = 0; v < V; ++v)
+    {
+        verti *begin = successors + index[v], *end = successors + index[v + 1];
+        if (!std::is_sorted(begin, end)) std::sort(begin, end);
+    }
+
+    if (edge_dir_ & EDGE_PREDECESSOR)
+    {
+        /* Create predecessor index by counting the predecessors of each vertex */
+        for (edgei e = 0; e < E; ++e) ++predecessor_index_[successors[e] + 1];
+        for (verti v = 0; v < V; ++v)
+        {
+            predecessor_index_[v + 1] += predecessor_index_[v];
+        }
+
+        /* Create predecessor lists; these are sorted since the vertices are
+           visited in increasing order. */
+        std::vector<edgei> pos(predecessor_index_, predecessor_index_ + V);
+        for (verti v = 0; v < V; ++v)
+        {
+            for (edgei e = index[v]; e < index[v + 1]; ++e)
+            {
+                predecessors_[pos[successors[e]]++] = v;
+            }
+        }
+    }
+}
+
 #endif // MCRL2_PG_GRAPH_IMPL_H
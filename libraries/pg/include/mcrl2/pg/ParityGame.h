@@ -222,6 +222,16 @@ public:
     void read_pgsolver( std::istream &is,
         StaticGraph::EdgeDirection edge_dir = StaticGraph::EDGE_BIDIRECTIONAL );
 
+    /*! Read a game description in PGSolver format from the characters in
+        [begin, end), for instance the contents of a memory mapped file.
+        The vertex specifications are parsed twice: first to count the
+        successors of each vertex, and then to write them directly into the
+        graph. The text is split at line ends into `number_of_threads` parts
+        that are parsed in parallel. */
+    void read_pgsolver( const char *begin, const char *end,
+        StaticGraph::EdgeDirection edge_dir = StaticGraph::EDGE_BIDIRECTIONAL,
+        std::size_t number_of_threads = 1 );
+
     /*! Write a game description in PGSolver format. */
     void write_pgsolver(std::ostream &os) const;
 
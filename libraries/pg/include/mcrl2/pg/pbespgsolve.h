@@ -135,6 +135,7 @@ struct pbespgsolve_options
   bool verify_solution;
   bool only_generate;
   data::rewriter::strategy rewrite_strategy;
+  std::size_t number_of_threads; // the number of threads that is used to read a parity game
 
   pbespgsolve_options()
     : solver_type(spm_solver),
@@ -143,7 +144,8 @@ struct pbespgsolve_options
       use_deloop_solver(true),
       verify_solution(true),
       only_generate(false),
-      rewrite_strategy(data::jitty)
+      rewrite_strategy(data::jitty),
+      number_of_threads(1)
   {
   }
 };
@@ -11,6 +11,11 @@
 #include "mcrl2/pbes/parity_game_generator.h"
 #include "mcrl2/pg/ParityGame.h"
 
+#include <cctype>
+#include <iterator>
+#include <string>
+#include <thread>
+
 /* N.B. The PGSolver I/O functions reverse the priorities when reading/writing
    the game description. This is done to preserve solutions, since PGSolver
    considers higher values to dominate lower values, while I assume the opposite
@@ -19,91 +24,179 @@
 void ParityGame::read_pgsolver( std::istream &is,
                                 StaticGraph::EdgeDirection edge_dir )
 {
-    priority_t max_prio = 0;
-    std::vector<ParityGameVertex> vertices;
-    StaticGraph::edge_list edges;
-
-    // Read "parity" header line (if present)
-    char ch = 0;
-    while (!isalnum(ch)) is.get(ch);
-    is.putback(ch);
-    if (!isdigit(ch))
-    {
-        std::string parity;
-        verti max_vertex;
+    std::string text( (std::istreambuf_iterator<char>(is)),
+                      std::istreambuf_iterator<char>() );
+    read_pgsolver(text.data(), text.data() + text.size(), edge_dir);
+}
 
-        if (!(is >> parity >> max_vertex)) return;
-        if (parity != "parity") return;
-        vertices.reserve(max_vertex + 1);
+namespace {
 
-        // Skip to terminating semicolon
-        while (is.get(ch) && ch != ';') ch = 0;
-    }
+/* A vertex specification as it occurs in a PGSolver file. */
+struct PGSolverVertex
+{
+    verti      id;
+    priority_t priority;
+    player_t   player;
+    edgei      out_degree;
+};
 
-    // Read and discard "start" line (if present)
-    while (!isalnum(ch)) is.get(ch);
-    is.putback(ch);
-    if (!isdigit(ch))
-    {
-        std::string start;
-        verti vertex;
+bool is_space(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
 
-        if (!(is >> start >> vertex)) return;
-        if (start != "start") return;
+bool is_digit(char ch)
+{
+    return ch >= '0' && ch <= '9';
+}
 
-        // Skip to terminating semicolon
-        while (is.get(ch) && ch != ';') ch = 0;
-    }
+bool read_number(const char *&p, const char *end, std::size_t &result)
+{
+    while (p != end && is_space(*p)) ++p;
+    if (p == end || !is_digit(*p)) return false;
+    result = 0;
+    while (p != end && is_digit(*p)) result = 10*result + (*p++ - '0');
+    return true;
+}
 
-    // Invalid vertex (used to mark uninitialized vertices)
-    ParityGameVertex invalid = { PLAYER_EVEN, (priority_t)-1 };
+/* Skips to the character after the next semicolon. */
+void skip_statement(const char *&p, const char *end)
+{
+    while (p != end && *p++ != ';') { }
+}
 
-    // Read vertex specs
-    while (is)
-    {
-        verti id;
-        int prio_raw, player_raw;
+/* Parses the vertex specification at p, and calls add_successor(w) for each
+   successor w. Returns false if there is no vertex specification at p. */
+template<class Function>
+bool parse_vertex( const char *&p, const char *end, PGSolverVertex &vertex,
+                   Function add_successor )
+{
+    std::size_t priority, player;
+    if ( !read_number(p, end, vertex.id) || !read_number(p, end, priority) ||
+         !read_number(p, end, player) ) return false;
 
-        if (!(is >> id >> prio_raw >> player_raw)) break;
+    assert(priority < 65536);
+    assert(player == 0 || player == 1);
+    vertex.priority   = priority;
+    vertex.player     = static_cast<player_t>(player);
+    vertex.out_degree = 0;
 
-        assert(prio_raw >= 0);
-        assert(prio_raw < 65536);
-        priority_t prio = prio_raw;
+    char ch = 0;
+    do {
+        verti succ;
+        if (!read_number(p, end, succ)) return false;
+        add_successor(succ);
+        ++vertex.out_degree;
+
+        // Skip to separator (comma) or end-of-list (semicolon), while
+        // ignoring the contents of quoted strings.
+        bool quoted = false, escaped = false;
+        ch = 0;
+        while (p != end) {
+            ch = *p++;
+            if (ch == '"' && !escaped) quoted = !quoted;
+            escaped = ch == '\\' && !escaped;
+            if ((ch == ',' || ch == ';') && !quoted) break;
+        }
+    } while (p != end && ch == ',');
+    return true;
+}
 
-        assert(player_raw == 0 || player_raw == 1);
-        player_t player = static_cast<player_t>(player_raw);
+/* Calls f(i) for i = 0, 1, ..., n - 1, in n threads. */
+template<class Function>
+void run_in_threads(std::size_t n, Function f)
+{
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < n; ++i) threads.emplace_back(f, i);
+    f(0);
+    for (std::thread &t : threads) t.join();
+}
 
-        if (prio > max_prio) max_prio = prio;
-        if (id >= vertices.size()) vertices.resize(id + 1, invalid);
+} // namespace
 
-        /* FIXME: the PGSolver file format description allows vertices to be
-                  defined more than once (in that case, the old vertex should
-                  be removed), but we currently don't support that. Instead,
-                  just assert that each vertex is initialized once. */
-        assert(vertices[id] == invalid);
+void ParityGame::read_pgsolver( const char *begin, const char *end,
+                                StaticGraph::EdgeDirection edge_dir,
+                                std::size_t number_of_threads )
+{
+    const char *p = begin;
 
-        vertices[id].player   = player;
-        vertices[id].priority = prio;
+    // Read "parity" header line (if present)
+    while (p != end && !isalnum(*p)) ++p;
+    if (p != end && !is_digit(*p))
+    {
+        verti max_vertex;
+        if (std::string(p, std::find_if(p, end, is_space)) != "parity") return;
+        p += 6;
+        if (!read_number(p, end, max_vertex)) return;
+        skip_statement(p, end);
+    }
 
-        // Read successors
-        do {
-            verti succ;
-            if (!(is >> succ)) break;
-            if (succ >= vertices.size()) vertices.resize(succ + 1, invalid);
+    // Read and discard "start" line (if present)
+    while (p != end && !isalnum(*p)) ++p;
+    if (p != end && !is_digit(*p))
+    {
+        verti vertex;
+        if (std::string(p, std::find_if(p, end, is_space)) != "start") return;
+        p += 5;
+        if (!read_number(p, end, vertex)) return;
+        skip_statement(p, end);
+    }
 
-            edges.push_back(std::make_pair(id, succ));
+    // Split the vertex specifications into parts that end with a semicolon
+    // at the end of a line.
+    number_of_threads = std::max<std::size_t>(1, number_of_threads);
+    std::vector<const char*> parts(1, p);
+    for (std::size_t i = 1; i < number_of_threads; ++i)
+    {
+        const char *q = std::max(parts.back(), p + (end - p)*i/number_of_threads);
+        while (q != end && !(*q == '\n' && q - 1 > p && q[-1] == ';')) ++q;
+        parts.push_back(q);
+    }
+    parts.push_back(end);
+
+    // First pass: read vertex specs and count successors
+    std::vector<std::vector<PGSolverVertex> > vertex_specs(number_of_threads);
+    std::vector<verti> max_ids(number_of_threads, 0);
+    run_in_threads(number_of_threads, [&](std::size_t i) {
+        const char *q = parts[i];
+        PGSolverVertex vertex;
+        verti &max_id = max_ids[i];
+        while (parse_vertex( q, parts[i + 1], vertex,
+                             [&](verti succ) { max_id = std::max(max_id, succ); } ))
+        {
+            max_id = std::max(max_id, vertex.id);
+            vertex_specs[i].push_back(vertex);
+        }
+    });
 
-            // Skip to separator (comma) or end-of-list (semicolon), while
-            // ignoring the contents of quoted strings.
-            bool quoted = false, escaped = false;
-            while (is.get(ch)) {
-                if (ch == '"' && !escaped) quoted = !quoted;
-                escaped = ch == '\\' && !escaped;
-                if ((ch == ',' || ch == ';') && !quoted) break;
-            }
+    verti num_ids = 0;
+    for (std::size_t i = 0; i < number_of_threads; ++i)
+    {
+        if (!vertex_specs[i].empty()) num_ids = std::max(num_ids, max_ids[i] + 1);
+    }
 
-        } while (is && ch == ',');
+    // Invalid vertex (used to mark uninitialized vertices)
+    ParityGameVertex invalid = { PLAYER_EVEN, (priority_t)-1 };
+    std::vector<ParityGameVertex> vertices(num_ids, invalid);
+    std::vector<edgei> out_degree(num_ids, 0);
+    priority_t max_prio = 0;
+    for (const std::vector<PGSolverVertex> &specs : vertex_specs)
+    {
+        for (const PGSolverVertex &vertex : specs)
+        {
+            /* FIXME: the PGSolver file format description allows vertices to
+                      be defined more than once (in that case, the old vertex
+                      should be removed), but we currently don't support that.
+                      Instead, just assert that each vertex is initialized
+                      once. */
+            assert(vertices[vertex.id] == invalid);
+            vertices[vertex.id].player   = vertex.player;
+            vertices[vertex.id].priority = vertex.priority;
+            out_degree[vertex.id] = vertex.out_degree;
+            if (vertex.priority > max_prio) max_prio = vertex.priority;
+        }
     }
+    vertex_specs.clear();
 
     // Ensure max_prio is even, so max_prio - p preserves parity:
     if (max_prio%2 == 1) ++max_prio;
@@ -114,24 +207,13 @@ void ParityGame::read_pgsolver( std::istream &is,
     for (verti v = 0; v < (verti)vertices.size(); ++v)
     {
         if (vertices[v] != invalid) {
-            vertices[used] = vertices[v];
+            vertices[used]   = vertices[v];
+            out_degree[used] = out_degree[v];
             vertex_map[v] = used++;
         }
     }
-    if (used < (verti)vertices.size())
-    {
-        // Remove unused vertices:
-        vertices.erase(vertices.begin() + used, vertices.end());
-
-        // Remap edges to new vertex indices:
-        for ( StaticGraph::edge_list::iterator it = edges.begin();
-              it != edges.end(); ++it )
-        {
-            it->first  = vertex_map[it->first];
-            it->second = vertex_map[it->second];
-            assert(it->first != NO_VERTEX && it->second != NO_VERTEX);
-        }
-    }
+    vertices.erase(vertices.begin() + used, vertices.end());
+    out_degree.erase(out_degree.begin() + used, out_degree.end());
 
     // Assign vertex info and recount cardinalities
     reset((verti)vertices.size(), max_prio + 1);
@@ -144,8 +226,18 @@ void ParityGame::read_pgsolver( std::istream &is,
     recalculate_cardinalities(vertices.size());
     vertices.clear();
 
-    // Assign graph
-    graph_.assign(edges, edge_dir);
+    // Second pass: read the successors directly into the graph
+    graph_.assign(out_degree, [&](verti *successors, const edgei *index) {
+        run_in_threads(number_of_threads, [&](std::size_t i) {
+            const char *q = parts[i];
+            PGSolverVertex vertex;
+            // The identifier of the vertex is read before its successors.
+            while (parse_vertex( q, parts[i + 1], vertex, [&](verti succ) {
+                assert(vertex_map[succ] != NO_VERTEX);
+                successors[index[vertex_map[vertex.id]] + vertex.out_degree] = vertex_map[succ];
+            } )) { }
+        });
+    }, edge_dir);
 }
 
 void ParityGame::write_pgsolver(std::ostream &os) const
@@ -59,9 +59,10 @@ multi_action_name multiset_difference(const multi_action_name& alpha, const mult
 inline
 multi_action_name multiset_union(const multi_action_name& alpha, const multi_action_name& beta)
 {
-  multi_action_name result;
-  std::merge(alpha.begin(), alpha.end(), beta.begin(), beta.end(), std::inserter(result, result.end()));
-  return result;
+  std::vector<core::identifier_string> names;
+  names.reserve(alpha.size() + beta.size());
+  std::merge(alpha.begin(), alpha.end(), beta.begin(), beta.end(), std::back_inserter(names));
+  return multi_action_name(names.begin(), names.end());
 }
 
 //-----------------------------------------------------//
@@ -719,7 +720,7 @@ void rename_inverse(const rename_inverse_map& Rinverse, const multi_action_name&
     auto j = Rinverse.find(*i);
     if (j != Rinverse.end())
     {
-      alpha.erase(i++);
+      i = alpha.erase(i);
       if (!j->second.empty() || !x_includes_subsets)
       {
         V.push_back(j->second);
@@ -765,13 +766,10 @@ multi_action_name_set allow(const action_name_multiset_list& V, const multi_acti
   {
     const core::identifier_string_list& names = s.names();
     multi_action_name v(names.begin(), names.end());
-    for (const multi_action_name& alpha: A)
+    bool keep = A_includes_subsets ? subset_includes(A, v) : A.find(v) != A.end();
+    if (keep)
     {
-      bool keep = A_includes_subsets ? includes(alpha, v) : alpha == v;
-      if (keep)
-      {
-        result.insert(v);
-      }
+      result.insert(v);
     }
   }
   return result;
@@ -15,24 +15,112 @@
 #include "mcrl2/atermpp/aterm_io_text.h"
 #include "mcrl2/core/identifier_string.h"
 
+#include <algorithm>
+#include <initializer_list>
+#include <set>
+#include <vector>
+
 namespace mcrl2 {
 
 namespace process {
 
 /// \brief Represents the name of a multi action
-struct multi_action_name: public std::multiset<core::identifier_string>
+/// \details The name is a multiset of action names, which is stored as a sorted vector. Multi action
+///          names are small, and are frequently copied, compared and combined during alphabet reduction.
+///          A sorted vector supports this much more efficiently than a std::multiset, while it provides
+///          the same interface and the same order.
+class multi_action_name
 {
-  typedef std::multiset<core::identifier_string> super;
+protected:
+  std::vector<core::identifier_string> m_names;
+
+public:
+  typedef core::identifier_string value_type;
+  typedef std::vector<core::identifier_string>::size_type size_type;
+  typedef std::vector<core::identifier_string>::const_iterator const_iterator;
+  typedef const_iterator iterator;
 
   multi_action_name() = default;
 
   template <typename InputIterator>
   multi_action_name(InputIterator first, InputIterator last)
-    : super(first, last)
+    : m_names(first, last)
+  {
+    std::sort(m_names.begin(), m_names.end());
+  }
+
+  multi_action_name(std::initializer_list<core::identifier_string> names)
+    : multi_action_name(names.begin(), names.end())
   {}
+
+  const_iterator begin() const { return m_names.begin(); }
+  const_iterator end() const { return m_names.end(); }
+  bool empty() const { return m_names.empty(); }
+  size_type size() const { return m_names.size(); }
+
+  /// \brief Inserts the action name a after the action names that are equal to it.
+  iterator insert(const core::identifier_string& a)
+  {
+    return m_names.insert(std::upper_bound(m_names.begin(), m_names.end(), a), a);
+  }
+
+  /// \brief Inserts the action name a. The hint is ignored, it allows the use of std::inserter.
+  iterator insert(const_iterator /* hint */, const core::identifier_string& a)
+  {
+    return insert(a);
+  }
+
+  template <typename InputIterator>
+  void insert(InputIterator first, InputIterator last)
+  {
+    m_names.insert(m_names.end(), first, last);
+    std::sort(m_names.begin(), m_names.end());
+  }
+
+  /// \brief Removes all occurrences of the action name a.
+  /// \returns The number of removed occurrences.
+  size_type erase(const core::identifier_string& a)
+  {
+    auto range = std::equal_range(m_names.begin(), m_names.end(), a);
+    size_type result = range.second - range.first;
+    m_names.erase(range.first, range.second);
+    return result;
+  }
+
+  /// \brief Removes the occurrence at position i.
+  iterator erase(const_iterator i)
+  {
+    return m_names.erase(i);
+  }
+
+  const_iterator find(const core::identifier_string& a) const
+  {
+    auto i = std::lower_bound(m_names.begin(), m_names.end(), a);
+    return i != m_names.end() && *i == a ? i : m_names.end();
+  }
+
+  size_type count(const core::identifier_string& a) const
+  {
+    auto range = std::equal_range(m_names.begin(), m_names.end(), a);
+    return range.second - range.first;
+  }
+
+  bool operator==(const multi_action_name& other) const
+  {
+    return m_names == other.m_names;
+  }
+
+  bool operator!=(const multi_action_name& other) const
+  {
+    return m_names != other.m_names;
+  }
+
+  bool operator<(const multi_action_name& other) const
+  {
+    return m_names < other.m_names;
+  }
 };
 
-/// \brief Represents a set of multi action names
 typedef std::set<multi_action_name> multi_action_name_set;
 
 /// \brief Pretty print function for a multi action name
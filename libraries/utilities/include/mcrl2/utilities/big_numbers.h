@@ -264,6 +264,15 @@ class big_natural_number
       return m_number.size()==1 && m_number.front()==n;
     }
 
+    /** \brief Returns whether this number fits in a std::size_t.
+        \details If so, it can be converted to a std::size_t without an exception.
+    */
+    bool is_machine_number() const
+    {
+      is_well_defined();
+      return m_number.size()<=1;
+    }
+
     /** \brief Sets the number to zero.
         \details This is more efficient than using an assignment x=0.
     */
@@ -10,8 +10,10 @@
 #ifndef MCRL2_UTILITIES_BITSTREAM_H
 #define MCRL2_UTILITIES_BITSTREAM_H
 
+#include <cstdint>
+#include <istream>
+#include <ostream>
 #include <vector>
-#include <bitset>
 
 namespace mcrl2
 {
@@ -26,7 +28,9 @@ constexpr std::size_t integer_encoding_size()
 }
 
 /// \brief A bitstream provides per bit writing of data to any stream (including stdout).
-/// \details Internally uses bitpacking and buffering for compact and efficient IO.
+/// \details Internally uses bitpacking and buffering for compact and efficient IO. The bits are
+///          collected in a 64 bit word that is written as a whole, most significant byte first.
+///          The total number of bytes written is always a multiple of eight.
 class obitstream
 {
 public:
@@ -36,7 +40,7 @@ public:
 
   /// \brief Write the num_of_bits least significant bits in descending order from value.
   /// @param value Variable that contains the bits.
-  /// @param num_of_bits Number of bits to write to the output stream.
+  /// @param num_of_bits Number of bits to write to the output stream, at most 64.
   void write_bits(std::size_t value, unsigned int num_of_bits);
 
   /// \brief Write the given string to the output stream.
@@ -55,10 +59,13 @@ private:
   /// \brief Writes size bytes from the given buffer.
   void write(const std::uint8_t* buffer, std::size_t size);
 
+  /// \brief Writes the given word to the stream, most significant byte first.
+  void write_word(std::uint64_t word);
+
   std::ostream& stream;
 
-  /// \brief Buffer that is filled starting from bit 127 when writing
-  std::bitset<128> write_buffer = 0;
+  /// \brief Buffer that is filled starting from bit 63 when writing.
+  std::uint64_t write_buffer = 0;
 
   unsigned int bits_in_buffer = 0; ///< how many bits in are used in the buffer.
 
@@ -67,6 +74,8 @@ private:
 
 /// \brief The counterpart of obitstream, guarantees that the same data is read as has been written when calling the read operators
 ///        in the same sequence as the corresponding write operators.
+/// \details The input is read in words of 64 bits. As an obitstream always writes a multiple of eight bytes, this never reads
+///          beyond the data written by the corresponding obitstream.
 class ibitstream
 {
 public:
@@ -74,7 +83,7 @@ public:
   ibitstream(std::istream& stream);
 
   /// \brief Reads an num_of_bits bits from the input stream and stores them in the least significant part (in descending order) of the return value.
-  /// \param num_of_bits Number of bits to read from the input stream.
+  /// \param num_of_bits Number of bits to read from the input stream, at most 64.
   std::size_t read_bits(unsigned int num_of_bits);
 
   /// \returns A pointer to the read string.
@@ -88,10 +97,13 @@ private:
   /// \brief Read size bytes into the provided buffer.
   void read(std::size_t size, std::uint8_t* buffer);
 
+  /// \brief Reads the next 64 bit word from the stream, most significant byte first.
+  std::uint64_t read_word();
+
   std::istream& stream;
 
-  /// \brief Buffer that is filled starting from bit 127 when reading.
-  std::bitset<128> read_buffer = 0;
+  /// \brief Buffer that contains the bits that have not yet been read starting from bit 63.
+  std::uint64_t read_buffer = 0;
 
   unsigned int bits_in_buffer = 0; ///< how many bits in the buffer are used.
 
@@ -0,0 +1,96 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MCRL2_UTILITIES_DETAIL_BOUNDED_BUFFER_H_
+#define MCRL2_UTILITIES_DETAIL_BOUNDED_BUFFER_H_
+
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace mcrl2
+{
+namespace utilities
+{
+namespace detail
+{
+
+/// \brief A first-in first-out buffer with a maximal number of elements, used to pass
+///        elements from one producing thread to one or more consuming threads.
+/// \details A producer that pushes into a full buffer blocks until an element has been
+///          taken out. A consumer that pops from an empty buffer blocks until an element
+///          is pushed, or until the buffer is closed.
+template<typename Element>
+class bounded_buffer
+{
+public:
+  explicit bounded_buffer(std::size_t capacity)
+    : m_capacity(capacity)
+  {
+    assert(capacity > 0);
+  }
+
+  bounded_buffer(const bounded_buffer&) = delete;
+  bounded_buffer& operator=(const bounded_buffer&) = delete;
+
+  /// \brief Adds an element at the end of the buffer. Blocks while the buffer is full.
+  void push(Element&& element)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_not_full.wait(lock, [this]() { return m_elements.size() < m_capacity; });
+    assert(!m_closed);
+    m_elements.emplace_back(std::move(element));
+    lock.unlock();
+    m_not_empty.notify_one();
+  }
+
+  /// \brief Takes the first element out of the buffer, and moves it into element.
+  /// \returns False iff the buffer is closed and no elements are left.
+  bool pop(Element& element)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_not_empty.wait(lock, [this]() { return !m_elements.empty() || m_closed; });
+    if (m_elements.empty())
+    {
+      return false;
+    }
+    element = std::move(m_elements.front());
+    m_elements.pop_front();
+    lock.unlock();
+    m_not_full.notify_one();
+    return true;
+  }
+
+  /// \brief Indicates that no more elements will be pushed. Consumers still
+  ///        receive the elements that are in the buffer.
+  void close()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_closed = true;
+    }
+    m_not_empty.notify_all();
+  }
+
+private:
+  const std::size_t m_capacity;
+  std::deque<Element> m_elements;
+  bool m_closed = false;
+
+  std::mutex m_mutex;
+  std::condition_variable m_not_empty;
+  std::condition_variable m_not_full;
+};
+
+} // namespace detail
+} // namespace utilities
+} // namespace mcrl2
+
+#endif // MCRL2_UTILITIES_DETAIL_BOUNDED_BUFFER_H_
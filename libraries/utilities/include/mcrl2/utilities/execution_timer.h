@@ -13,6 +13,8 @@
 #define MCRL2_UTILITIES_EXECUTION_TIMER_H
 
 #include "mcrl2/utilities/exception.h"
+#include "mcrl2/utilities/metrics.h"
+#include <chrono>
 #include <ctime>
 #include <cmath>
 #include <fstream>
@@ -43,6 +45,9 @@ namespace utilities
 ///
 /// Note that this is an output format that can immediately be parsed using
 /// YAML (http://www.yaml.org/)
+///
+/// If the global metrics registry is enabled, the wall clock time of every
+/// measurement is also recorded as a phase of the registry.
 class execution_timer
 {
   protected:
@@ -52,6 +57,7 @@ class execution_timer
     {
       clock_t start;
       clock_t finish;
+      std::chrono::steady_clock::time_point wall_clock_start; ///< Used for the phases of the metrics registry.
 
       timing() :
         start(0),
@@ -120,6 +126,7 @@ class execution_timer
       }
       t = m_timings.insert(t, make_pair(timing_name, timing()));
       t->second.start = clock();
+      t->second.wall_clock_start = std::chrono::steady_clock::now();
     }
 
     /// \brief Finish a measurement with a hint
@@ -139,6 +146,11 @@ class execution_timer
         throw mcrl2::runtime_error("Finishing timing '" + timing_name + "' for the second time.");
       }
       t->second.finish = finish;
+
+      if (metrics().enabled())
+      {
+        metrics().timer(timing_name).add(std::chrono::steady_clock::now() - t->second.wall_clock_start);
+      }
     }
 
     /// \brief Write all timing information that has been recorded.
@@ -0,0 +1,81 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef MCRL2_UTILITIES_MAPPED_FILE_H_
+#define MCRL2_UTILITIES_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace mcrl2
+{
+namespace utilities
+{
+
+/// \brief The read-only contents of a file that are mapped into memory.
+/// \details On platforms that support it the file is mapped using mmap, such that its pages are
+///          only read from disk (or taken from the page cache) when they are accessed. Otherwise,
+///          and for files that cannot be mapped such as pipes, the contents are read into a buffer.
+class mapped_file
+{
+public:
+  /// \brief Maps the file with the given name into memory.
+  /// \throws mcrl2::runtime_error when the file cannot be opened.
+  explicit mapped_file(const std::string& filename);
+  ~mapped_file();
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  /// \returns A pointer to the first byte of the file.
+  const char* data() const { return m_data; }
+
+  /// \returns The number of bytes in the file.
+  std::size_t size() const { return m_size; }
+
+private:
+  const char* m_data = nullptr;
+  std::size_t m_size = 0;
+  bool m_mapped = false; ///< Indicates that m_data is mapped, instead of pointing into m_buffer.
+  std::vector<char> m_buffer;
+};
+
+/// \brief An input stream that reads from the contents of a mapped file, which avoids the
+///        intermediate buffer and system calls of a std::ifstream.
+class mapped_file_istream : public std::istream
+{
+public:
+  /// \brief Opens the file with the given name for reading.
+  /// \throws mcrl2::runtime_error when the file cannot be opened.
+  explicit mapped_file_istream(const std::string& filename);
+
+private:
+  /// \brief A stream buffer whose get area is the contents of the file.
+  class buffer : public std::streambuf
+  {
+  public:
+    explicit buffer(const mapped_file& file);
+
+  protected:
+    std::streamsize xsgetn(char* s, std::streamsize count) override;
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+  };
+
+  mapped_file m_file;
+  buffer m_buffer;
+};
+
+} // namespace utilities
+} // namespace mcrl2
+
+#endif // MCRL2_UTILITIES_MAPPED_FILE_H_
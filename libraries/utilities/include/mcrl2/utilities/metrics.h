@@ -0,0 +1,175 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/utilities/metrics.h
+/// \brief A registry of performance metrics, which can be written in JSON format.
+
+#ifndef MCRL2_UTILITIES_METRICS_H
+#define MCRL2_UTILITIES_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace mcrl2
+{
+namespace utilities
+{
+
+/// \brief A counter of a metrics registry.
+class metric_counter
+{
+public:
+  /// \brief Adds n to the counter.
+  void add(std::size_t n = 1) { m_value.fetch_add(n, std::memory_order_relaxed); }
+
+  std::size_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<std::size_t> m_value{0};
+};
+
+/// \brief A histogram of a metrics registry.
+/// \details Bucket i counts the recorded values v with 2^(i-1) <= v < 2^i, and bucket 0 counts the value 0.
+class metric_histogram
+{
+public:
+  static constexpr std::size_t number_of_buckets = 65;
+
+  /// \brief Records the given value.
+  void record(std::size_t value);
+
+  /// \returns The number of recorded values.
+  std::size_t count() const { return m_count.load(std::memory_order_relaxed); }
+
+  /// \returns The sum of the recorded values.
+  std::size_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+
+  /// \returns The largest recorded value.
+  std::size_t max() const { return m_max.load(std::memory_order_relaxed); }
+
+  /// \returns The number of recorded values in the given bucket.
+  std::size_t bucket(std::size_t i) const { return m_buckets[i].load(std::memory_order_relaxed); }
+
+private:
+  std::array<std::atomic<std::size_t>, number_of_buckets> m_buckets{};
+  std::atomic<std::size_t> m_count{0};
+  std::atomic<std::size_t> m_sum{0};
+  std::atomic<std::size_t> m_max{0};
+};
+
+/// \brief The accumulated wall clock time of a phase, and the number of times that it was executed.
+class metric_timer
+{
+public:
+  /// \brief Adds an execution of the phase that took the given duration.
+  void add(std::chrono::steady_clock::duration duration)
+  {
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_nanoseconds.fetch_add(static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()),
+                            std::memory_order_relaxed);
+  }
+
+  std::size_t count() const { return m_count.load(std::memory_order_relaxed); }
+
+  /// \returns The total duration of the phase in seconds.
+  double seconds() const { return static_cast<double>(m_nanoseconds.load(std::memory_order_relaxed)) / 1e9; }
+
+private:
+  std::atomic<std::size_t> m_count{0};
+  std::atomic<std::size_t> m_nanoseconds{0};
+};
+
+/// \brief A registry of named performance metrics.
+/// \details Metrics are only collected when the registry is enabled, which tools do for the option --metrics.
+///          The references returned by counter, histogram and timer remain valid, such that frequently updated
+///          metrics can be looked up once. Code that reports metrics should check enabled() before doing so.
+class metrics_registry
+{
+public:
+  /// \returns Whether metrics are collected.
+  bool enabled() const { return m_enabled; }
+
+  /// \brief Starts the collection of metrics.
+  void enable() { m_enabled = true; }
+
+  /// \returns The counter with the given name, which is created if it does not exist yet.
+  metric_counter& counter(const std::string& name);
+
+  /// \returns The histogram with the given name, which is created if it does not exist yet.
+  metric_histogram& histogram(const std::string& name);
+
+  /// \returns The timer of the phase with the given name, which is created if it does not exist yet.
+  metric_timer& timer(const std::string& name);
+
+  /// \brief Sets the gauge with the given name to value.
+  void set_gauge(const std::string& name, std::size_t value);
+
+  /// \brief Sets the gauge with the given name to the result of probe when the metrics are written.
+  void add_probe(const std::string& name, std::function<std::size_t()> probe);
+
+  /// \brief Writes all metrics, including the peak resident set size, as a JSON object.
+  void write_json(std::ostream& out) const;
+
+  /// \brief Writes all metrics as a JSON object to the file with the given name.
+  /// \throws mcrl2::runtime_error when the file cannot be written.
+  void write_json(const std::string& filename) const;
+
+private:
+  bool m_enabled = false;
+  mutable std::mutex m_mutex;
+  std::map<std::string, std::unique_ptr<metric_counter>> m_counters;
+  std::map<std::string, std::unique_ptr<metric_histogram>> m_histograms;
+  std::map<std::string, std::unique_ptr<metric_timer>> m_timers;
+  std::map<std::string, std::size_t> m_gauges;
+  std::map<std::string, std::function<std::size_t()>> m_probes;
+};
+
+/// \returns The global metrics registry.
+metrics_registry& metrics();
+
+/// \returns The peak resident set size of this process in bytes, or 0 if it cannot be determined.
+std::size_t peak_resident_set_size();
+
+/// \brief Adds the time between its construction and destruction to the timer of the given phase,
+///        if the global metrics registry is enabled.
+class metrics_phase
+{
+public:
+  explicit metrics_phase(const std::string& name)
+    : m_timer(metrics().enabled() ? &metrics().timer(name) : nullptr),
+      m_start(std::chrono::steady_clock::now())
+  {}
+
+  ~metrics_phase()
+  {
+    if (m_timer != nullptr)
+    {
+      m_timer->add(std::chrono::steady_clock::now() - m_start);
+    }
+  }
+
+  metrics_phase(const metrics_phase&) = delete;
+  metrics_phase& operator=(const metrics_phase&) = delete;
+
+private:
+  metric_timer* m_timer;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace utilities
+} // namespace mcrl2
+
+#endif // MCRL2_UTILITIES_METRICS_H
@@ -16,6 +16,7 @@
 
 #include "mcrl2/utilities/command_line_interface.h"
 #include "mcrl2/utilities/execution_timer.h"
+#include "mcrl2/utilities/metrics.h"
 #include "mcrl2/utilities/platform.h"
 
 #ifdef MCRL2_PLATFORM_WINDOWS
@@ -62,6 +63,9 @@ class tool
     /// Determines whether timing output should be written
     bool m_timing_enabled;
 
+    /// The filename to which the metrics must be written, or the empty string if they are not collected
+    std::string m_metrics_filename;
+
     /// \brief Add options to an interface description.
     /// \param desc An interface description
     virtual void add_options(interface_description& desc)
@@ -69,6 +73,9 @@ class tool
       desc.add_option("timings", make_optional_argument<std::string>("FILE", ""),
                       "append timing measurements to FILE. Measurements are written to "
                       "standard error if no FILE is provided");
+      desc.add_option("metrics", make_file_argument("FILE"),
+                      "collect performance metrics, such as the duration of phases, counters, histograms and "
+                      "the peak memory usage, and write them to FILE in JSON format");
     }
 
     /// \brief Parse non-standard options
@@ -81,6 +88,11 @@ class tool
         log::mcrl2_logger::set_report_time_info();
         m_timing_filename = parser.option_argument("timings");
       }
+      if (parser.has_option("metrics"))
+      {
+        m_metrics_filename = parser.option_argument("metrics");
+        metrics().enable();
+      }
     }
 
     /// \brief Executed only if run would be executed and invoked before run.
@@ -224,6 +236,11 @@ class tool
             {
               timer().report();
             }
+
+            if (!m_metrics_filename.empty())
+            {
+              metrics().write_json(m_metrics_filename);
+            }
           }
 
           // Either pre_run or run failed.
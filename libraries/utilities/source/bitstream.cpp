@@ -80,6 +80,18 @@ int_t decode_variablesize_int(ibitstream& stream)
   return value;
 }
 
+/// \returns The value shifted to the left by the given number of bits, where shifting by 64 or more bits yields zero.
+static inline std::uint64_t shift_left(std::uint64_t value, unsigned int number_of_bits)
+{
+  return number_of_bits < 64 ? value << number_of_bits : 0;
+}
+
+/// \returns The value shifted to the right by the given number of bits, where shifting by 64 or more bits yields zero.
+static inline std::uint64_t shift_right(std::uint64_t value, unsigned int number_of_bits)
+{
+  return number_of_bits < 64 ? value >> number_of_bits : 0;
+}
+
 /// \brief Change the current stream to binary mode (no handle of newline characters),
 static void set_stream_binary(const std::string& name, FILE* handle)
 {
@@ -114,27 +126,24 @@ obitstream::obitstream(std::ostream& stream)
 
 void obitstream::write_bits(std::size_t value, unsigned int number_of_bits)
 {
-  // Add val to the buffer by masking out additional bits and put them at left-most position free in the buffer.
-  write_buffer |= std::bitset<128>(value & ((static_cast<std::size_t>(1) << number_of_bits) - 1)) << ((128 - bits_in_buffer) - number_of_bits);
-  bits_in_buffer += number_of_bits;
+  assert(number_of_bits <= 64);
 
-  // Write 8 bytes if available
-  if (bits_in_buffer >= 64)
-  {
-    unsigned long long write_value = (write_buffer >> 64).to_ullong();
-    write_buffer <<= 64;
-    bits_in_buffer -= 64;
+  // Mask out the bits that should not be written.
+  const std::uint64_t bits = static_cast<std::uint64_t>(value) & ~shift_left(~static_cast<std::uint64_t>(0), number_of_bits);
 
-    for (int32_t i = 7; i >= 0; --i)
-    {
-      // Write the 8 * i most significant bits and mask out the other values.
-      stream.put(static_cast<char>((write_value >> (8 * i)) & 255));
-
-      if (stream.fail())
-      {
-        throw mcrl2::runtime_error("Failed to write bytes to the output file/stream.");
-      }
-    }
+  if (bits_in_buffer + number_of_bits < 64)
+  {
+    // Put the bits at the left-most free position in the buffer.
+    write_buffer |= bits << (64 - bits_in_buffer - number_of_bits);
+    bits_in_buffer += number_of_bits;
+  }
+  else
+  {
+    // Fill the buffer, write it and keep the remaining bits.
+    const unsigned int remaining_bits = bits_in_buffer + number_of_bits - 64;
+    write_word(write_buffer | (bits >> remaining_bits));
+    write_buffer = shift_left(bits, 64 - remaining_bits);
+    bits_in_buffer = remaining_bits;
   }
 }
 
@@ -189,33 +198,22 @@ std::size_t ibitstream::read_bits(unsigned int number_of_bits)
   // Read at most the number of bits of a std::size_t.
   assert(number_of_bits <= std::numeric_limits<std::size_t>::digits);
 
-  while (bits_in_buffer < number_of_bits)
+  if (number_of_bits <= bits_in_buffer)
   {
-    // Read bytes until the buffer is sufficiently full.
-    int byte = stream.get();
-
-    if (stream.eof())
-    {
-      throw mcrl2::runtime_error("Unexpected end-of-file reached in the input file/stream.");
-    }
-    else if (stream.fail())
-    {
-      throw mcrl2::runtime_error("Failed to read bytes from the input file/stream.");
-    }
-
-    // Shift the 8 bits to the first free (120 - bits_in_buffer) position in the buffer.
-    read_buffer |= std::bitset<128>(static_cast<std::size_t>(byte)) << (56 + 64 - bits_in_buffer);
-    bits_in_buffer += 8;
+    // Take the bits from the most significant part of the buffer.
+    const std::uint64_t value = shift_right(read_buffer, 64 - number_of_bits);
+    read_buffer = shift_left(read_buffer, number_of_bits);
+    bits_in_buffer -= number_of_bits;
+    return static_cast<std::size_t>(value);
   }
 
-  // Read nr_bits from the buffer by shifting them to the least significant bits and masking out the remaining bits.
-  std::size_t value = (read_buffer >> (128 - number_of_bits)).to_ullong();
-
-  // Shift the first bit to the first position in the buffer.
-  read_buffer <<= number_of_bits;
-  bits_in_buffer -= number_of_bits;
-
-  return value;
+  // Take the bits that are left in the buffer, and the remaining bits from the next word.
+  const unsigned int remaining_bits = number_of_bits - bits_in_buffer;
+  const std::uint64_t word = read_word();
+  const std::uint64_t value = shift_left(shift_right(read_buffer, 64 - bits_in_buffer), remaining_bits) | (word >> (64 - remaining_bits));
+  read_buffer = shift_left(word, remaining_bits);
+  bits_in_buffer = 64 - remaining_bits;
+  return static_cast<std::size_t>(value);
 }
 
 std::size_t ibitstream::read_integer()
@@ -238,6 +236,21 @@ void obitstream::flush()
   }
 }
 
+void obitstream::write_word(std::uint64_t word)
+{
+  char bytes[8];
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    bytes[i] = static_cast<char>((word >> (56 - 8 * i)) & 255);
+  }
+
+  stream.write(bytes, 8);
+  if (stream.fail())
+  {
+    throw mcrl2::runtime_error("Failed to write bytes to the output file/stream.");
+  }
+}
+
 void obitstream::write(const uint8_t* buffer, std::size_t size)
 {
   for (std::size_t index = 0; index < size; ++index)
@@ -247,6 +260,23 @@ void obitstream::write(const uint8_t* buffer, std::size_t size)
   }
 }
 
+std::uint64_t ibitstream::read_word()
+{
+  unsigned char bytes[8];
+  if (stream.rdbuf()->sgetn(reinterpret_cast<char*>(bytes), 8) != 8)
+  {
+    stream.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+    throw mcrl2::runtime_error("Unexpected end-of-file reached in the input file/stream.");
+  }
+
+  std::uint64_t word = 0;
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    word = (word << 8) | bytes[i];
+  }
+  return word;
+}
+
 void ibitstream::read(std::size_t size, std::uint8_t* buffer)
 {
   for (std::size_t index = 0; index < size; ++index)
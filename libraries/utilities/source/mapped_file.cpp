@@ -0,0 +1,134 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "mcrl2/utilities/mapped_file.h"
+
+#include "mcrl2/utilities/exception.h"
+#include "mcrl2/utilities/platform.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef MCRL2_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // MCRL2_PLATFORM_WINDOWS
+
+using namespace mcrl2::utilities;
+
+mapped_file::mapped_file(const std::string& filename)
+{
+#ifndef MCRL2_PLATFORM_WINDOWS
+  int descriptor = open(filename.c_str(), O_RDONLY);
+  if (descriptor == -1)
+  {
+    throw mcrl2::runtime_error("Could not open file " + filename + ".");
+  }
+
+  struct stat status;
+  if (fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+  {
+    void* address = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (address != MAP_FAILED)
+    {
+      // The file is typically read from front to back, which allows the kernel to read ahead.
+      madvise(address, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+      m_data = static_cast<const char*>(address);
+      m_size = static_cast<std::size_t>(status.st_size);
+      m_mapped = true;
+    }
+  }
+
+  // The mapping remains valid after the file has been closed.
+  close(descriptor);
+  if (m_mapped)
+  {
+    return;
+  }
+#endif // MCRL2_PLATFORM_WINDOWS
+
+  // Fall back to reading the whole file into a buffer.
+  std::ifstream stream(filename, std::ios_base::binary);
+  if (!stream.good())
+  {
+    throw mcrl2::runtime_error("Could not open file " + filename + ".");
+  }
+
+  m_buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  m_data = m_buffer.data();
+  m_size = m_buffer.size();
+}
+
+mapped_file::~mapped_file()
+{
+#ifndef MCRL2_PLATFORM_WINDOWS
+  if (m_mapped)
+  {
+    munmap(const_cast<char*>(m_data), m_size);
+  }
+#endif // MCRL2_PLATFORM_WINDOWS
+}
+
+mapped_file_istream::buffer::buffer(const mapped_file& file)
+{
+  // The get area is never written to, as putback is not supported beyond the start of the file.
+  char* begin = const_cast<char*>(file.data());
+  setg(begin, begin, begin + file.size());
+}
+
+std::streamsize mapped_file_istream::buffer::xsgetn(char* s, std::streamsize count)
+{
+  const std::streamsize available = std::min(count, static_cast<std::streamsize>(egptr() - gptr()));
+  std::memcpy(s, gptr(), static_cast<std::size_t>(available));
+  setg(eback(), gptr() + available, egptr());
+  return available;
+}
+
+mapped_file_istream::buffer::pos_type mapped_file_istream::buffer::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+  if ((which & std::ios_base::in) == 0)
+  {
+    return pos_type(off_type(-1));
+  }
+
+  off_type position = off;
+  if (dir == std::ios_base::cur)
+  {
+    position += gptr() - eback();
+  }
+  else if (dir == std::ios_base::end)
+  {
+    position += egptr() - eback();
+  }
+
+  if (position < 0 || position > egptr() - eback())
+  {
+    return pos_type(off_type(-1));
+  }
+
+  setg(eback(), eback() + position, egptr());
+  return pos_type(position);
+}
+
+mapped_file_istream::buffer::pos_type mapped_file_istream::buffer::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+  return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+mapped_file_istream::mapped_file_istream(const std::string& filename)
+  : std::istream(nullptr),
+    m_file(filename),
+    m_buffer(m_file)
+{
+  rdbuf(&m_buffer);
+}
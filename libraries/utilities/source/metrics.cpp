@@ -0,0 +1,212 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "mcrl2/utilities/metrics.h"
+
+#include "mcrl2/utilities/exception.h"
+#include "mcrl2/utilities/platform.h"
+
+#include <fstream>
+#include <iomanip>
+
+#ifndef MCRL2_PLATFORM_WINDOWS
+#include <sys/resource.h>
+#endif // MCRL2_PLATFORM_WINDOWS
+
+using namespace mcrl2::utilities;
+
+namespace
+{
+
+/// \brief Writes s as a JSON string; metric names only contain printable characters.
+void write_json_string(std::ostream& out, const std::string& s)
+{
+  out << '"';
+  for (char c: s)
+  {
+    if (c == '"' || c == '\\')
+    {
+      out << '\\';
+    }
+    out << c;
+  }
+  out << '"';
+}
+
+/// \brief Writes the separator before the next member of a JSON object.
+void write_separator(std::ostream& out, bool& first)
+{
+  out << (first ? "\n" : ",\n");
+  first = false;
+}
+
+} // namespace
+
+void metric_histogram::record(std::size_t value)
+{
+  std::size_t bucket = 0;
+  for (std::size_t v = value; v != 0; v >>= 1)
+  {
+    ++bucket;
+  }
+  m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_sum.fetch_add(value, std::memory_order_relaxed);
+
+  std::size_t max = m_max.load(std::memory_order_relaxed);
+  while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+  {}
+}
+
+metric_counter& metrics_registry::counter(const std::string& name)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  std::unique_ptr<metric_counter>& result = m_counters[name];
+  if (result == nullptr)
+  {
+    result.reset(new metric_counter());
+  }
+  return *result;
+}
+
+metric_histogram& metrics_registry::histogram(const std::string& name)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  std::unique_ptr<metric_histogram>& result = m_histograms[name];
+  if (result == nullptr)
+  {
+    result.reset(new metric_histogram());
+  }
+  return *result;
+}
+
+metric_timer& metrics_registry::timer(const std::string& name)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  std::unique_ptr<metric_timer>& result = m_timers[name];
+  if (result == nullptr)
+  {
+    result.reset(new metric_timer());
+  }
+  return *result;
+}
+
+void metrics_registry::set_gauge(const std::string& name, std::size_t value)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_gauges[name] = value;
+}
+
+void metrics_registry::add_probe(const std::string& name, std::function<std::size_t()> probe)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_probes[name] = std::move(probe);
+}
+
+void metrics_registry::write_json(std::ostream& out) const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+
+  out << "{\n  \"counters\": {";
+  bool first = true;
+  for (const auto& [name, counter]: m_counters)
+  {
+    write_separator(out, first);
+    out << "    ";
+    write_json_string(out, name);
+    out << ": " << counter->value();
+  }
+
+  out << "\n  },\n  \"histograms\": {";
+  first = true;
+  for (const auto& [name, histogram]: m_histograms)
+  {
+    write_separator(out, first);
+    out << "    ";
+    write_json_string(out, name);
+    out << ": { \"count\": " << histogram->count() << ", \"sum\": " << histogram->sum()
+        << ", \"max\": " << histogram->max() << ", \"buckets\": [";
+
+    // Trailing empty buckets are omitted.
+    std::size_t last = metric_histogram::number_of_buckets;
+    while (last > 0 && histogram->bucket(last - 1) == 0)
+    {
+      --last;
+    }
+    for (std::size_t i = 0; i < last; ++i)
+    {
+      out << (i == 0 ? "" : ", ") << histogram->bucket(i);
+    }
+    out << "] }";
+  }
+
+  out << "\n  },\n  \"phases\": {";
+  first = true;
+  for (const auto& [name, timer]: m_timers)
+  {
+    write_separator(out, first);
+    out << "    ";
+    write_json_string(out, name);
+    out << ": { \"count\": " << timer->count() << ", \"seconds\": " << std::fixed << std::setprecision(6)
+        << timer->seconds() << " }";
+  }
+
+  // Probes are evaluated now, and take precedence over explicitly set gauges with the same name.
+  std::map<std::string, std::size_t> gauges = m_gauges;
+  for (const auto& [name, probe]: m_probes)
+  {
+    gauges[name] = probe();
+  }
+
+  out << "\n  },\n  \"gauges\": {";
+  first = true;
+  for (const auto& [name, value]: gauges)
+  {
+    write_separator(out, first);
+    out << "    ";
+    write_json_string(out, name);
+    out << ": " << value;
+  }
+
+  out << "\n  },\n  \"peak_resident_set_size\": " << peak_resident_set_size() << "\n}\n";
+}
+
+void metrics_registry::write_json(const std::string& filename) const
+{
+  std::ofstream out(filename);
+  if (!out.good())
+  {
+    throw mcrl2::runtime_error("Could not open file " + filename + " for writing the metrics.");
+  }
+  write_json(out);
+}
+
+metrics_registry& mcrl2::utilities::metrics()
+{
+  static metrics_registry registry;
+  return registry;
+}
+
+std::size_t mcrl2::utilities::peak_resident_set_size()
+{
+#ifndef MCRL2_PLATFORM_WINDOWS
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#ifdef MCRL2_PLATFORM_MAC
+    // On Mac OS the maximum resident set size is given in bytes.
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+    // Elsewhere it is given in kilobytes.
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif // MCRL2_PLATFORM_MAC
+  }
+#endif // MCRL2_PLATFORM_WINDOWS
+  return 0;
+}
@@ -43,3 +43,31 @@ BOOST_AUTO_TEST_CASE(fixed_sequence_test)
   BOOST_CHECK_EQUAL(strcmp(output.read_string(), "function_symbol"), 0);
   BOOST_CHECK_EQUAL(output.read_integer(), 5);
 }
+
+BOOST_AUTO_TEST_CASE(mixed_width_test)
+{
+  std::stringstream stream;
+
+  // Write values of every width, such that they cross the boundaries of the internal 64 bit words.
+  {
+    obitstream input(stream);
+    for (unsigned int width = 0; width <= 64; ++width)
+    {
+      input.write_bits(std::numeric_limits<std::size_t>::max(), width);
+      input.write_bits(0x5555555555555555ULL, width);
+      input.write_integer(width * 1000003);
+    }
+  }
+
+  // An obitstream always writes a multiple of eight bytes.
+  BOOST_CHECK_EQUAL(stream.str().size() % 8, 0u);
+
+  ibitstream output(stream);
+  for (unsigned int width = 0; width <= 64; ++width)
+  {
+    const std::size_t mask = width == 64 ? std::numeric_limits<std::size_t>::max() : (static_cast<std::size_t>(1) << width) - 1;
+    BOOST_CHECK_EQUAL(output.read_bits(width), mask);
+    BOOST_CHECK_EQUAL(output.read_bits(width), 0x5555555555555555ULL & mask);
+    BOOST_CHECK_EQUAL(output.read_integer(), width * 1000003);
+  }
+}
@@ -38,3 +38,22 @@ BOOST_AUTO_TEST_CASE(test_function_cache)
   }
 
 }
+
+BOOST_AUTO_TEST_CASE(test_fifo_cache)
+{
+  fifo_cache<int, int> cache(4);
+  for (int i = 0; i < 100; ++i)
+  {
+    cache.emplace(i, i*i);
+  }
+
+  // The last inserted element is still present, and the first ones have been evicted.
+  auto it = cache.find(99);
+  BOOST_REQUIRE(it != cache.end());
+  BOOST_CHECK_EQUAL(it->second, 99*99);
+  BOOST_CHECK_EQUAL(cache.count(0), 0u);
+
+  // Inserting an existing key does not change its value.
+  BOOST_CHECK(!cache.emplace(99, 0).second);
+  BOOST_CHECK_EQUAL(cache.find(99)->second, 99*99);
+}
@@ -0,0 +1,81 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "mcrl2/utilities/bitstream.h"
+#include "mcrl2/utilities/exception.h"
+#include "mcrl2/utilities/mapped_file.h"
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace mcrl2::utilities;
+
+BOOST_AUTO_TEST_CASE(bitstream_test)
+{
+  std::string filename = "mapped_file_test.out";
+  {
+    std::ofstream stream(filename, std::ios_base::binary);
+    obitstream output(stream);
+    output.write_integer(1337);
+    output.write_string("test");
+    output.write_bits(5, 3);
+  }
+
+  {
+    mapped_file_istream stream(filename);
+    ibitstream input(stream);
+    BOOST_CHECK_EQUAL(input.read_integer(), 1337);
+    BOOST_CHECK_EQUAL(std::string(input.read_string()), "test");
+    BOOST_CHECK_EQUAL(input.read_bits(3), 5);
+  }
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(text_test)
+{
+  std::string filename = "mapped_file_test.txt";
+  {
+    std::ofstream stream(filename);
+    stream << "first 42\nsecond";
+  }
+
+  {
+    mapped_file_istream stream(filename);
+    std::string word;
+    int number;
+    stream >> word >> number;
+    BOOST_CHECK_EQUAL(word, "first");
+    BOOST_CHECK_EQUAL(number, 42);
+
+    stream.seekg(0, std::ios_base::end);
+    BOOST_CHECK_EQUAL(stream.tellg(), 15);
+    stream.seekg(9);
+    stream >> word;
+    BOOST_CHECK_EQUAL(word, "second");
+
+    stream >> word;
+    BOOST_CHECK(stream.eof());
+  }
+
+  // Empty files cannot be mapped, but can be read.
+  {
+    std::ofstream stream(filename, std::ios_base::trunc);
+  }
+  {
+    mapped_file_istream stream(filename);
+    BOOST_CHECK_EQUAL(stream.get(), std::char_traits<char>::eof());
+  }
+
+  std::remove(filename.c_str());
+  BOOST_CHECK_THROW(mapped_file_istream stream(filename), mcrl2::runtime_error);
+}
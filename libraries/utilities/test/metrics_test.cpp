@@ -0,0 +1,85 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "mcrl2/utilities/execution_timer.h"
+#include "mcrl2/utilities/metrics.h"
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+
+#include <sstream>
+
+using namespace mcrl2::utilities;
+
+BOOST_AUTO_TEST_CASE(histogram_test)
+{
+  metric_histogram histogram;
+  histogram.record(0);
+  histogram.record(1);
+  histogram.record(5);
+  histogram.record(7);
+  histogram.record(8);
+
+  BOOST_CHECK_EQUAL(histogram.count(), 5u);
+  BOOST_CHECK_EQUAL(histogram.sum(), 21u);
+  BOOST_CHECK_EQUAL(histogram.max(), 8u);
+  BOOST_CHECK_EQUAL(histogram.bucket(0), 1u);
+  BOOST_CHECK_EQUAL(histogram.bucket(1), 1u);
+  BOOST_CHECK_EQUAL(histogram.bucket(2), 0u);
+  BOOST_CHECK_EQUAL(histogram.bucket(3), 2u);
+  BOOST_CHECK_EQUAL(histogram.bucket(4), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(registry_test)
+{
+  metrics_registry registry;
+  BOOST_CHECK(!registry.enabled());
+
+  registry.counter("calls").add();
+  registry.counter("calls").add(2);
+  BOOST_CHECK_EQUAL(registry.counter("calls").value(), 3u);
+
+  registry.histogram("sizes").record(3);
+  registry.timer("phase").add(std::chrono::milliseconds(1500));
+  registry.set_gauge("states", 42);
+  std::size_t probed = 1;
+  registry.add_probe("probed", [&probed]() { return probed; });
+  probed = 7;
+
+  std::ostringstream out;
+  registry.write_json(out);
+  const std::string json = out.str();
+  BOOST_CHECK(json.find("\"calls\": 3") != std::string::npos);
+  BOOST_CHECK(json.find("\"sizes\": { \"count\": 1, \"sum\": 3, \"max\": 3, \"buckets\": [0, 0, 1] }") != std::string::npos);
+  BOOST_CHECK(json.find("\"phase\": { \"count\": 1, \"seconds\": 1.500000 }") != std::string::npos);
+  BOOST_CHECK(json.find("\"states\": 42") != std::string::npos);
+  BOOST_CHECK(json.find("\"probed\": 7") != std::string::npos);
+  BOOST_CHECK(json.find("\"peak_resident_set_size\": ") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(execution_timer_test)
+{
+  // Measurements of an execution timer are only recorded when the global registry is enabled.
+  execution_timer timer;
+  timer.start("before");
+  timer.finish("before");
+  metrics().enable();
+  timer.start("after");
+  timer.finish("after");
+  {
+    metrics_phase phase("scoped");
+  }
+
+  std::ostringstream out;
+  metrics().write_json(out);
+  const std::string json = out.str();
+  BOOST_CHECK(json.find("\"before\"") == std::string::npos);
+  BOOST_CHECK(json.find("\"after\": { \"count\": 1") != std::string::npos);
+  BOOST_CHECK(json.find("\"scoped\": { \"count\": 1") != std::string::npos);
+}
@@ -0,0 +1,56 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file ./lpsoptimise.cpp
+
+#include "mcrl2/lps/tools.h"
+#include "mcrl2/utilities/input_output_tool.h"
+#include "mcrl2/data/rewriter_tool.h"
+
+using namespace mcrl2;
+using namespace mcrl2::lps;
+using namespace mcrl2::utilities;
+using namespace mcrl2::utilities::tools;
+
+using mcrl2::data::tools::rewriter_tool;
+
+class lpsoptimise_tool: public rewriter_tool<input_output_tool>
+{
+  protected:
+    typedef rewriter_tool<input_output_tool> super;
+
+  public:
+    lpsoptimise_tool()
+      : super(
+        "lpsoptimise",
+        "mCRL2 team",
+        "simplifies an LPS by repeatedly applying rewriting, sum, constant and parameter elimination",
+        make_tool_description(
+          "Simplify the LPS in INFILE and write the result to OUTFILE. The transformations of "
+          "lpsrewr, lpssumelm, lpsconstelm and lpsparelm are applied in this order, and are "
+          "repeated as long as the LPS becomes smaller. Compared to running these tools one "
+          "after the other, this avoids writing and reading the intermediate LPSs and "
+          "constructing a rewriter for each of them."
+        )
+      )
+    {}
+
+    bool run() override
+    {
+      lpsoptimise(input_filename(),
+                  output_filename(),
+                  rewrite_strategy()
+                 );
+      return true;
+    }
+};
+
+int main(int argc, char** argv)
+{
+  return lpsoptimise_tool().execute(argc, argv);
+}
@@ -13,6 +13,7 @@
 #include "mcrl2/data/rewriter_tool.h"
 #include "mcrl2/lps/is_stochastic.h"
 #include "mcrl2/lts/lts_io.h"
+#include "mcrl2/lts/lts_reducing_builder.h"
 #include "mcrl2/lts/stochastic_lts_builder.h"
 #include "mcrl2/lts/state_space_generator.h"
 #include "mcrl2/utilities/input_output_tool.h"
@@ -27,6 +28,7 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
 
   lps::explorer_options options;
   lts::lts_type output_format = lts::lts_none;
+  lts::lts_equivalence equivalence = lts::lts_eq_none;
   lps::abortable* current_explorer = nullptr;
   std::set<std::string> trace_multiaction_strings;
 
@@ -107,6 +109,19 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
       desc.add_option("save-at-end", "delay saving of the generated LTS until the end. "
                  "This option only applies to .aut and .lts files, which are by default saved on the fly.");
       desc.add_option("no-info", "do not add state label information to OUTFILE. This option only applies to .lts files.");
+      desc.add_option("reduce", utilities::make_enum_argument<lts::lts_equivalence>("NAME")
+                   .add_value(lts::lts_eq_none, true)
+                   .add_value(lts::lts_eq_bisim)
+                   .add_value(lts::lts_eq_branching_bisim)
+                   .add_value(lts::lts_eq_divergence_preserving_branching_bisim)
+                   .add_value(lts::lts_eq_weak_bisim)
+                   .add_value(lts::lts_eq_divergence_preserving_weak_bisim)
+                   .add_value(lts::lts_eq_trace)
+                   .add_value(lts::lts_eq_weak_trace)
+                   .add_value(lts::lts_red_tau_star),
+                 "reduce the generated LTS modulo equivalence NAME before saving it. The transitions are stored "
+                 "by a separate thread during exploration, and the LTS is not written to disk before it is reduced. "
+                 "This option only applies to .aut and .lts files of non-stochastic specifications:");
     }
 
     static std::list<std::string> split_actions(const std::string& s)
@@ -212,6 +227,7 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
       options.dfs_recursive                         = parser.has_option("dfs-recursive");
       options.discard_lts_state_labels              = parser.has_option("no-info");
       options.search_strategy = parser.option_argument_as<lps::exploration_strategy>("strategy");
+      equivalence = parser.option_argument_as<lts::lts_equivalence>("reduce");
 
       // highway search
       if (parser.has_option("todo-max"))
@@ -306,6 +322,11 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
       {
         parser.error("Option '--no-info' requires that the output is in .lts format.");
       }
+
+      if (equivalence != lts::lts_eq_none && (output_filename().empty() || (output_format != lts::lts_aut && output_format != lts::lts_lts)))
+      {
+        parser.error("Option '--reduce' requires that the output is in .aut or .lts format.");
+      }
     }
 
     template <bool Stochastic, bool Timed, typename Specification, typename LTSBuilder>
@@ -317,6 +338,17 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
       builder.save(output_filename());
     }
 
+    // Returns a builder that reduces the generated lts before saving it.
+    std::unique_ptr<lts::lts_builder> create_reducing_lts_builder(const lps::specification& lpsspec)
+    {
+      if (output_format == lts::lts_aut)
+      {
+        return std::make_unique<lts::lts_reducing_builder<lts::lts_aut_builder> >(equivalence);
+      }
+      return std::make_unique<lts::lts_reducing_builder<lts::lts_lts_builder> >(equivalence, lpsspec.data(), lpsspec.action_labels(),
+                                                                                 lpsspec.process().process_parameters(), options.discard_lts_state_labels);
+    }
+
     bool run() override
     {
       mCRL2log(log::verbose) << options << std::endl;
@@ -331,6 +363,10 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
 
       if (lps::is_stochastic(stochastic_lpsspec))
       {
+        if (equivalence != lts::lts_eq_none)
+        {
+          throw mcrl2::runtime_error("Option '--reduce' cannot be used for stochastic specifications.");
+        }
         auto builder = create_stochastic_lts_builder(stochastic_lpsspec, options, output_format);
         if (is_timed)
         {
@@ -344,7 +380,8 @@ class generatelts_tool: public rewriter_tool<input_output_tool>
       else
       {
         lps::specification lpsspec = lps::remove_stochastic_operators(stochastic_lpsspec);
-        auto builder = create_lts_builder(lpsspec, options, output_format, output_filename());
+        auto builder = equivalence == lts::lts_eq_none ? create_lts_builder(lpsspec, options, output_format, output_filename())
+                                                       : create_reducing_lts_builder(lpsspec);
         if (is_timed)
         {
           generate_state_space<false, true>(lpsspec, *builder);
@@ -77,6 +77,10 @@ class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
     /// \brief a contradiction nor a tautology. If the string is empty, no files are written.
     std::string m_dot_file_name;
 
+    /// \brief The name of the file in which proven confluence conditions are stored between runs.
+    /// \brief If the string is empty, no file is used.
+    std::string m_proof_cache_file_name;
+
     /// \brief The maximal number of seconds spent on proving a single confluence condition.
     int m_time_limit;
 
@@ -110,6 +114,10 @@ class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
       {
         m_dot_file_name = parser.option_argument_as< std::string >("print-dot");
       }
+      if (parser.options.count("proof-cache"))
+      {
+        m_proof_cache_file_name = parser.option_argument_as< std::string >("proof-cache");
+      }
       if (parser.options.count("summand"))
       {
         m_summand_number = parser.option_argument_as< std::size_t >("summand");
@@ -177,6 +185,10 @@ class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
       add_option("print-dot", make_mandatory_argument("PREFIX"),
                  "save a .dot file of the resulting BDD in case two summands cannot be proven "
                  "confluent; PREFIX will be used as prefix of the output files", 'p').
+      add_option("proof-cache", make_file_argument("FILE"),
+                 "read the confluence conditions that were proven before from FILE, and write the "
+                 "proven conditions to FILE afterwards, such that a rerun on a slightly modified LPS "
+                 "only proves the conditions of the summands that changed").
       add_option("time-limit", make_mandatory_argument("LIMIT"),
                  "spend at most LIMIT seconds on proving a single formula", 't').
       add_option("induction", "apply induction on lists", 'o');
@@ -238,7 +250,8 @@ class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
           spec, rewrite_strategy(),
           m_time_limit, m_path_eliminator, solver_type(),
           m_apply_induction, m_check_all, m_no_sums, m_conditions,
-          m_counter_example, m_generate_invariants, m_dot_file_name);
+          m_counter_example, m_generate_invariants, m_dot_file_name,
+          m_proof_cache_file_name);
 
         v_confluence_checker.check_confluence_and_mark(m_invariant, m_summand_number);
         save_lps(spec, output_filename());
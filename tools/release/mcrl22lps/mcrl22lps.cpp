@@ -32,6 +32,7 @@ class mcrl22lps_tool : public rewriter_tool< input_output_tool >
     mcrl2::lps::t_lin_options m_linearisation_options;
     // bool noalpha;   // indicates whether alpha reduction is needed.
     bool opt_check_only;
+    std::string m_cache_filename;
 
   protected:
 
@@ -127,6 +128,10 @@ class mcrl22lps_tool : public rewriter_tool< input_output_tool >
       desc.add_option("balance-summands",
                       "transform inputs expressions p1 + ... + pn into a balanced tree before "
                       "linearising. Sometimes helpful in preventing stack overflow.");
+      desc.add_option("cache", mcrl2::utilities::make_file_argument("FILE"),
+                      "store the resulting LPS in FILE, together with the specification and the options. "
+                      "When the specification and the options are unchanged in a later run, the LPS is "
+                      "taken from FILE instead of linearising the specification again.");
     }
 
     void parse_options(const mcrl2::utilities::command_line_parser& parser)
@@ -151,6 +156,11 @@ class mcrl22lps_tool : public rewriter_tool< input_output_tool >
 
       m_linearisation_options.lin_method = parser.option_argument_as< mcrl2::lps::t_lin_method >("lin-method");
 
+      if (parser.options.count("cache"))
+      {
+        m_cache_filename = parser.option_argument_as< std::string >("cache");
+      }
+
       //check for dangerous and illegal option combinations
       if (m_linearisation_options.newstate && m_linearisation_options.lin_method == mcrl2::lps::lmStack)
       {
@@ -217,7 +227,9 @@ class mcrl22lps_tool : public rewriter_tool< input_output_tool >
 
 
       //store the result
-      mcrl2::lps::stochastic_specification linear_spec(mcrl2::lps::linearise(spec, m_linearisation_options));
+      mcrl2::lps::stochastic_specification linear_spec(m_cache_filename.empty() ?
+                                                         mcrl2::lps::linearise(spec, m_linearisation_options) :
+                                                         mcrl2::lps::linearise(spec, m_linearisation_options, m_cache_filename));
       mCRL2log(mcrl2::log::verbose) << "Writing LPS to "
                                     << (output_filename().empty() ? "stdout"
                                                                   : "file " + output_filename())
@@ -18,6 +18,7 @@
 
 #include "mcrl2/utilities/input_output_tool.h"
 #include "mcrl2/bes/pbes_input_output_tool.h"
+#include "mcrl2/bes/pbesinst_pgsolver.h"
 #include "mcrl2/data/rewriter_tool.h"
 
 #include "mcrl2/pbes/normalize.h"
@@ -158,7 +159,31 @@ class pbesinst_tool: public rewriter_tool<pbes_input_output_tool<input_output_to
         return false;
       }
 
-      if (m_strategy == pbesinst_lazy_strategy)
+      if (m_strategy == pbesinst_lazy_strategy && pbes_output_format() == bes::bes_format_pgsolver() && !m_remove_redundant_equations)
+      {
+        // The parity game is written while it is generated, so the BES is not stored.
+        if (!is_normalized(p))
+        {
+          algorithms::normalize(p);
+        }
+        if (output_filename().empty())
+        {
+          bes::pbesinst_pgsolver_algorithm algorithm(p.data(), m_rewrite_strategy, std::cout);
+          algorithm.run(p);
+        }
+        else
+        {
+          std::ofstream out(output_filename());
+          if (!out.good())
+          {
+            throw mcrl2::runtime_error("Could not open file " + output_filename());
+          }
+          bes::pbesinst_pgsolver_algorithm algorithm(p.data(), m_rewrite_strategy, out);
+          algorithm.run(p);
+        }
+        return true;
+      }
+      else if (m_strategy == pbesinst_lazy_strategy)
       {
         // TODO: let pbesinst handle ! and => properly
         if (!is_normalized(p))
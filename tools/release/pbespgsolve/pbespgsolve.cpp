@@ -18,6 +18,7 @@
 #include "mcrl2/pbes/detail/bes_equation_limit.h"
 #include "mcrl2/pg/pbespgsolve.h"
 #include "mcrl2/utilities/input_tool.h"
+#include "mcrl2/utilities/mapped_file.h"
 
 #include <queue>
 
@@ -58,6 +59,9 @@ class pg_solver_tool : public rewriter_tool<pbes_input_tool<input_tool> >
       desc.add_option("cycle", "Eliminate cycles", 'C');
       desc.add_option("verify", "Verify the solution", 'e');
       desc.add_option("onlygenerate", "Only generate the BES without solving", 'g');
+      desc.add_option("threads",
+                      make_mandatory_argument("NUM"),
+                      "Use NUM threads to read a parity game in PGSolver format (default 1)");
       desc.add_hidden_option("equation_limit",
                              make_optional_argument("NAME", "-1"),
                              "Set a limit to the number of generated BES equations",
@@ -73,6 +77,10 @@ class pg_solver_tool : public rewriter_tool<pbes_input_tool<input_tool> >
       m_options.use_decycle_solver = (parser.options.count("cycle") > 0);
       m_options.verify_solution = (parser.options.count("verify") > 0);
       m_options.only_generate = (parser.options.count("onlygenerate") > 0);
+      if (parser.options.count("threads") > 0)
+      {
+        m_options.number_of_threads = parser.option_argument_as<std::size_t>("threads");
+      }
       if (parser.options.count("equation_limit") > 0)
       {
         int limit = parser.option_argument_as<int>("equation_limit");
@@ -114,9 +122,16 @@ class pg_solver_tool : public rewriter_tool<pbes_input_tool<input_tool> >
       {
         pbespgsolve_algorithm algorithm(timer(), m_options);
         ParityGame pg;
-        std::ifstream is(input_filename().c_str());
         timer().start("load");
-        pg.read_pgsolver(is);
+        if (input_filename().empty())
+        {
+          pg.read_pgsolver(std::cin);
+        }
+        else
+        {
+          mapped_file file(input_filename());
+          pg.read_pgsolver(file.data(), file.data() + file.size(), StaticGraph::EDGE_BIDIRECTIONAL, m_options.number_of_threads);
+        }
         timer().finish("load");
 
         value = algorithm.run(pg, 0);